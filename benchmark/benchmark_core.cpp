@@ -0,0 +1,147 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// End-to-end benchmarks of TUV-x column calculations
+//
+// Usage: benchmark_core [benchmark options] [configuration file ...]
+//
+// The default configurations are examples/tuv_5_4.json and
+// examples/ts1_tsmlt.json, which must be run from a directory that contains
+// the TUV-x data folder (e.g., the build directory).
+#include "core_interface.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  /// @brief A radiative transfer solver configuration
+  struct Solver
+  {
+    const char* name_;
+    const char* type_;
+    int number_of_streams_;
+  };
+
+  /// @brief A solar zenith angle
+  struct ZenithAngle
+  {
+    const char* name_;
+    double degrees_;
+  };
+
+  const Solver SOLVERS[] = { { "delta_eddington", "delta eddington", 0 },
+                             { "discrete_ordinate_4", "discrete ordinate", 4 },
+                             { "discrete_ordinate_8", "discrete ordinate", 8 } };
+
+  const ZenithAngle ZENITH_ANGLES[] = { { "day", 30.0 }, { "terminator", 90.0 }, { "night", 100.0 } };
+
+  const int LABEL_LENGTH = 256;
+
+  /// @brief Cores built so far, by configuration file and solver
+  ///
+  /// Building a core for a full configuration takes much longer than a run,
+  /// so each core is built the first time it is benchmarked and then reused.
+  std::map<std::pair<std::string, std::string>, void*> cores;
+
+  /// @brief Returns the core for a configuration file and solver
+  void* GetCore(const std::string& config_path, const Solver& solver)
+  {
+    auto key = std::make_pair(config_path, std::string(solver.name_));
+    auto core = cores.find(key);
+    if (core != cores.end())
+      return core->second;
+    void* new_core = BenchmarkCoreCreate(config_path.c_str(), solver.type_, solver.number_of_streams_);
+    cores[key] = new_core;
+    return new_core;
+  }
+
+  /// @brief Returns a stage label that can be used as a counter name
+  std::string CounterName(const char* label)
+  {
+    std::string name(label);
+    for (auto& c : name)
+      if (c == ' ')
+        c = '_';
+    return name + "_s";
+  }
+}  // namespace
+
+/// @brief This function benchmarks calculations of one column
+/// @param state Benchmarking argument
+/// @param config_path Path to the TUV-x configuration file
+/// @param solver Radiative transfer solver
+/// @param zenith_angle Solar zenith angle
+/// @param all_rates Whether dose and heating rates are calculated with the photolysis rates
+static void BM_CORE_RUN(
+    benchmark::State& state,
+    std::string config_path,
+    Solver solver,
+    ZenithAngle zenith_angle,
+    bool all_rates)
+{
+  void* core = GetCore(config_path, solver);
+
+  // the first run allocates the run workspace
+  BenchmarkCoreRun(core, zenith_angle.degrees_, all_rates);
+  BenchmarkCoreResetTimings(core);
+  for (auto _ : state)
+  {
+    BenchmarkCoreRun(core, zenith_angle.degrees_, all_rates);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["columns_per_second"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+
+  // time per column for each top-level stage (per-reaction and per-radiator
+  // stages are in the core's timing report)
+  int number_of_stages = BenchmarkCoreNumberOfStages(core);
+  for (int i = 0; i < number_of_stages; ++i)
+  {
+    char label[LABEL_LENGTH];
+    double seconds;
+    int64_t calls;
+    BenchmarkCoreGetStage(core, i, label, LABEL_LENGTH, &seconds, &calls);
+    if (std::string(label).find(':') != std::string::npos)
+      continue;
+    state.counters[CounterName(label)] = benchmark::Counter(seconds, benchmark::Counter::kAvgIterations);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  BenchmarkInitialize();
+
+  std::vector<std::string> config_paths(argv + 1, argv + argc);
+  if (config_paths.empty())
+    config_paths = { "examples/tuv_5_4.json", "examples/ts1_tsmlt.json" };
+
+  for (const auto& config_path : config_paths)
+  {
+    for (const auto& solver : SOLVERS)
+    {
+      for (const auto& zenith_angle : ZENITH_ANGLES)
+      {
+        for (bool all_rates : { false, true })
+        {
+          std::string name = "BM_CORE_RUN/" + config_path + "/" + solver.name_ + "/" + zenith_angle.name_ + "/" +
+                             (all_rates ? "all_rates" : "photolysis");
+          benchmark::RegisterBenchmark(name.c_str(), BM_CORE_RUN, config_path, solver, zenith_angle, all_rates)
+              ->Unit(benchmark::kMillisecond);
+        }
+      }
+    }
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  for (auto& core : cores)
+    BenchmarkCoreDelete(core.second);
+  BenchmarkFinalize();
+  return 0;
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Micro-benchmarks of the TUV-x interpolators
+//
+// The source sizes span the cross-section and quantum-yield data in
+// data/cross_sections (hundreds to tens of thousands of points), and the
+// target sizes are those of the CAM (102 sections) and combined (156
+// sections) wavelength grids in data/grids/wavelength and of a fine 1000
+// section grid. Interpolating several rows onto the same grids, as is done
+// for temperature-dependent cross-section tables, shows how much of the work
+// could be saved by reusing the interpolation weights across rows.
+#include "interpolate_interface.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+/// @brief Numbers of source data points in the sweep
+const std::vector<int64_t> NUMBER_OF_SOURCE_POINTS = { 200, 2000, 20000 };
+
+/// @brief Numbers of target grid sections in the sweep
+const std::vector<int64_t> NUMBER_OF_TARGET_SECTIONS = { 102, 156, 1000 };
+
+/// @brief Numbers of source data rows interpolated onto the same grids
+const std::vector<int64_t> NUMBER_OF_ROWS = { 1, 8 };
+
+/// @brief This function benchmarks an interpolator
+///
+/// Points per second counts the source and target points of each row, as
+/// each interpolator makes one pass over both grids per row.
+/// @param state Benchmarking argument (source points, target sections, rows)
+/// @param interpolator_type Interpolator type, as in the TUV-x configuration
+static void BM_INTERPOLATE(benchmark::State& state, const char* interpolator_type)
+{
+  const int number_of_source_points = state.range(0);
+  const int number_of_target_points = state.range(1) + 1;
+  const int number_of_rows = state.range(2);
+  void* interpolator =
+      BenchmarkInterpolatorCreate(interpolator_type, number_of_source_points, number_of_target_points, number_of_rows);
+
+  for (auto _ : state)
+  {
+    BenchmarkInterpolatorRun(interpolator);
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_rows * (number_of_source_points + number_of_target_points));
+  BenchmarkInterpolatorDelete(interpolator);
+}
+
+/// @brief Sweeps the source sizes, target sizes, and numbers of rows
+static void Sweep(benchmark::internal::Benchmark* b)
+{
+  b->ArgNames({ "source", "target", "rows" })
+      ->ArgsProduct({ NUMBER_OF_SOURCE_POINTS, NUMBER_OF_TARGET_SECTIONS, NUMBER_OF_ROWS })
+      ->Unit(benchmark::kMicrosecond);
+}
+
+/// @brief Register the functions defined above as a benchmark
+BENCHMARK_CAPTURE(BM_INTERPOLATE, linear, "linear")->Apply(Sweep);
+BENCHMARK_CAPTURE(BM_INTERPOLATE, conserving, "conserving")->Apply(Sweep);
+BENCHMARK_CAPTURE(BM_INTERPOLATE, fractional_source, "fractional source")->Apply(Sweep);
+BENCHMARK_CAPTURE(BM_INTERPOLATE, fractional_target, "fractional target")->Apply(Sweep);
+
+/// @brief Run all benchmarks
+BENCHMARK_MAIN();
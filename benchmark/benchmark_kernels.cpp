@@ -0,0 +1,119 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Micro-benchmarks of individual TUV-x column kernels
+//
+// Usage: benchmark_kernels [benchmark options]
+//
+// The kernels are set up from the test data (test/data), so the benchmarks
+// must be run from the source directory or from a build directory with tests
+// enabled. Each kernel is timed across vertical resolutions and, for the
+// kernels that depend on it, solar zenith angles, in isolation from the
+// radiative transfer solver.
+#include "kernels_interface.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+/// @brief Numbers of layers in the height grid (the test data has 150)
+const std::vector<int64_t> NUMBER_OF_LAYERS = { 75, 150, 300, 600 };
+
+/// @brief Solar zenith angles [degrees], from overhead sun to twilight
+const std::vector<int64_t> ZENITH_ANGLES = { 0, 60, 85, 95 };
+
+/// @brief Times a kernel for state.range(0) layers at a solar zenith angle
+///
+/// Items per second counts the layers processed.
+/// @param state Benchmarking argument (layers, ...)
+/// @param kernel Kernel to time
+/// @param zenith_angle Solar zenith angle [degrees]
+/// @param cross_section_config_path Cross section test configuration (none if empty)
+template<typename F>
+static void TimeKernel(benchmark::State& state, F kernel, double zenith_angle, const char* cross_section_config_path = "")
+{
+  const int number_of_layers = state.range(0);
+  void* kernels = BenchmarkKernelsCreate(number_of_layers, cross_section_config_path);
+  BenchmarkKernelsSetZenithAngle(kernels, zenith_angle);
+  BenchmarkKernelsAirMass(kernels);
+
+  for (auto _ : state)
+  {
+    kernel(kernels);
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_layers);
+  BenchmarkKernelsDelete(kernels);
+}
+
+/// @brief This function benchmarks spherical_geometry_t%set_parameters
+/// @param state Benchmarking argument (layers, solar zenith angle)
+static void BM_SPHERICAL_GEOMETRY_SET_PARAMETERS(benchmark::State& state)
+{
+  const double zenith_angle = static_cast<double>(state.range(1));
+  TimeKernel(
+      state, [zenith_angle](void* kernels) { BenchmarkKernelsSetZenithAngle(kernels, zenith_angle); }, zenith_angle);
+}
+
+/// @brief This function benchmarks spherical_geometry_t%air_mass
+/// @param state Benchmarking argument (layers, solar zenith angle)
+static void BM_SPHERICAL_GEOMETRY_AIR_MASS(benchmark::State& state)
+{
+  TimeKernel(state, BenchmarkKernelsAirMass, static_cast<double>(state.range(1)));
+}
+
+/// @brief This function benchmarks la_sr_bands_t%optical_depth
+/// @param state Benchmarking argument (layers, solar zenith angle)
+static void BM_LA_SRB_OPTICAL_DEPTH(benchmark::State& state)
+{
+  TimeKernel(state, BenchmarkKernelsLaSrbOpticalDepth, static_cast<double>(state.range(1)));
+}
+
+/// @brief This function benchmarks la_sr_bands_t%cross_section
+/// @param state Benchmarking argument (layers, solar zenith angle)
+static void BM_LA_SRB_CROSS_SECTION(benchmark::State& state)
+{
+  TimeKernel(state, BenchmarkKernelsLaSrbCrossSection, static_cast<double>(state.range(1)));
+}
+
+/// @brief This function benchmarks the calculation of a temperature-dependent cross section
+///
+/// Cross sections do not depend on the solar zenith angle; the geometry is
+/// set up for an overhead sun.
+/// @param state Benchmarking argument (layers)
+/// @param config_path Cross section test configuration
+static void BM_CROSS_SECTION(benchmark::State& state, const char* config_path)
+{
+  TimeKernel(state, BenchmarkKernelsCrossSection, 0.0, config_path);
+}
+
+/// @brief Sweeps the vertical resolutions and solar zenith angles
+static void Sweep(benchmark::internal::Benchmark* b)
+{
+  b->ArgNames({ "layers", "sza" })->ArgsProduct({ NUMBER_OF_LAYERS, ZENITH_ANGLES })->Unit(benchmark::kMicrosecond);
+}
+
+/// @brief Sweeps the vertical resolutions (for kernels that do not depend on the solar zenith angle)
+static void SweepLayers(benchmark::internal::Benchmark* b)
+{
+  b->ArgNames({ "layers" })->ArgsProduct({ NUMBER_OF_LAYERS })->Unit(benchmark::kMicrosecond);
+}
+
+/// @brief Register the functions defined above as a benchmark
+BENCHMARK(BM_SPHERICAL_GEOMETRY_SET_PARAMETERS)->Apply(Sweep);
+BENCHMARK(BM_SPHERICAL_GEOMETRY_AIR_MASS)->Apply(Sweep);
+BENCHMARK(BM_LA_SRB_OPTICAL_DEPTH)->Apply(Sweep);
+BENCHMARK(BM_LA_SRB_CROSS_SECTION)->Apply(Sweep);
+BENCHMARK_CAPTURE(BM_CROSS_SECTION, no2_tint, "test/data/cross_sections/cross_section.no2_tint.config.json")
+    ->Apply(SweepLayers);
+BENCHMARK_CAPTURE(BM_CROSS_SECTION, tint, "test/data/cross_sections/cross_section.tint.config.json")
+    ->Apply(SweepLayers);
+BENCHMARK_CAPTURE(BM_CROSS_SECTION, ccl4, "test/data/cross_sections/cross_section.ccl4.config.json")
+    ->Apply(SweepLayers);
+BENCHMARK_CAPTURE(BM_CROSS_SECTION, hno3, "test/data/cross_sections/cross_section.hno3-oh_no2.config.json")
+    ->Apply(SweepLayers);
+BENCHMARK_CAPTURE(BM_CROSS_SECTION, n2o5, "test/data/cross_sections/cross_section.n2o5-no2_no3.config.json")
+    ->Apply(SweepLayers);
+
+/// @brief Run all benchmarks
+BENCHMARK_MAIN();
@@ -1,9 +1,10 @@
-
+#include <tuvx/linear_algebra/dispatch.hpp>
 #include <tuvx/linear_algebra/linear_algebra.hpp>
 
 #include <benchmark/benchmark.h>
 
-#include <random>
+#include <chrono>
+#include <cstdint>
 #include <vector>
 
 #ifdef TUVX_COMPILE_WITH_INTEL
@@ -12,115 +13,201 @@
   #include <lapacke.h>
 #endif
 
-const std::size_t SYSTEM_SIZE = 1e6;
+const unsigned RANDOM_NUMBER_SEED = 1;
 
-const bool MAKE_DIAGONALLY_DOMINANT = true;
+/// @brief Numbers of vertical layers in the sweep (each system has two unknowns per layer)
+const std::vector<int64_t> NUMBER_OF_LAYERS = { 50, 120, 250, 500, 1000 };
 
-const unsigned RANDOM_NUMBER_SEED = 1;
+/// @brief Numbers of columns solved in each batch
+const std::vector<int64_t> NUMBER_OF_COLUMNS = { 1, 100, 1000 };
 
-/// @brief This function benchmarks the lapacke tridiagonal matrix solver for single precision
-/// @param state Benchmarking argument
-static void BM_LAPACKE_SINGLE_PRECISISON(benchmark::State& state)
+/// @brief A batch of two-stream radiative transfer systems, one per column
+template<typename T>
+struct Batch
 {
-  std::vector<float> x(SYSTEM_SIZE);
-  std::vector<float> b(SYSTEM_SIZE);
-  tuvx::TridiagonalMatrix<float> A(SYSTEM_SIZE);
-  std::mt19937 random_device(RANDOM_NUMBER_SEED);
-  for (auto _ : state)
+  std::vector<tuvx::TridiagonalMatrix<T>> A_;
+  std::vector<std::vector<T>> b_;
+};
+
+/// @brief Builds a batch of two-stream radiative transfer systems
+/// @param number_of_layers Number of vertical layers in each column
+/// @param number_of_columns Number of columns
+template<typename T>
+static Batch<T> BuildBatch(std::size_t number_of_layers, std::size_t number_of_columns)
+{
+  Batch<T> batch;
+  batch.A_.assign(number_of_columns, tuvx::TridiagonalMatrix<T>(2 * number_of_layers));
+  batch.b_.assign(number_of_columns, std::vector<T>(2 * number_of_layers));
+  std::vector<T> x(2 * number_of_layers);
+  for (std::size_t i = 0; i < number_of_columns; i++)
   {
-    state.PauseTiming();
-    tuvx::FillRandom<float>(A, RANDOM_NUMBER_SEED, MAKE_DIAGONALLY_DOMINANT);
-    tuvx::FillRandom<float>(x, RANDOM_NUMBER_SEED);
-    b = tuvx::Dot<float>(A, x);
-    state.ResumeTiming();
-
-    LAPACKE_sgtsv(
-        LAPACK_ROW_MAJOR,
-        SYSTEM_SIZE,
-        1,
-        A.lower_diagonal_.data(),
-        A.main_diagonal_.data(),
-        A.upper_diagonal_.data(),
-        b.data(),
-        1);
+    tuvx::FillTwoStream<T>(batch.A_[i], RANDOM_NUMBER_SEED + i);
+    tuvx::FillRandom<T>(x, RANDOM_NUMBER_SEED + i);
+    batch.b_[i] = tuvx::Dot<T>(batch.A_[i], x);
   }
+  return batch;
 }
 
-/// @brief This function benchmarks the lapacke tridiagonal matrix solver for double precision
+/// @brief Times a batch solver over the systems for state.range(0) layers and state.range(1) columns
+///
+/// The systems are generated once. The solvers overwrite their inputs, so each iteration solves a
+/// fresh copy of the systems; only the solve is timed (the benchmarks use manual timing), so the
+/// copy, like the generation, is not part of the reported times. The counters report systems
+/// solved per second and the bytes of the three diagonals and right-hand side of each system per
+/// second.
 /// @param state Benchmarking argument
-static void BM_LAPACKE_DOUBLE_PRECISISON(benchmark::State& state)
+/// @param solve_batch Solves each system in a batch in place
+template<typename T, typename F>
+static void TimeBatches(benchmark::State& state, F solve_batch)
 {
-  std::vector<double> x(SYSTEM_SIZE);
-  std::vector<double> b(SYSTEM_SIZE);
-  tuvx::TridiagonalMatrix<double> A(SYSTEM_SIZE);
+  const std::size_t number_of_layers = state.range(0);
+  const std::size_t number_of_columns = state.range(1);
+  const Batch<T> systems = BuildBatch<T>(number_of_layers, number_of_columns);
+  Batch<T> work = systems;
 
-  std::mt19937 random_device(RANDOM_NUMBER_SEED);
-  // Perform setup here
   for (auto _ : state)
   {
-    state.PauseTiming();
-    tuvx::FillRandom<double>(A, RANDOM_NUMBER_SEED, MAKE_DIAGONALLY_DOMINANT);
-    tuvx::FillRandom<double>(x, RANDOM_NUMBER_SEED);
-    b = tuvx::Dot<double>(A, x);
-    state.ResumeTiming();
-
-    LAPACKE_dgtsv(
-        LAPACK_ROW_MAJOR,
-        SYSTEM_SIZE,
-        1,
-        A.lower_diagonal_.data(),
-        A.main_diagonal_.data(),
-        A.upper_diagonal_.data(),
-        b.data(),
-        1);
+    work = systems;
+    auto start = std::chrono::steady_clock::now();
+    solve_batch(work);
+    benchmark::ClobberMemory();
+    auto end = std::chrono::steady_clock::now();
+    state.SetIterationTime(std::chrono::duration<double>(end - start).count());
   }
+  state.SetItemsProcessed(state.iterations() * number_of_columns);
+  state.SetBytesProcessed(state.iterations() * number_of_columns * 4 * 2 * number_of_layers * sizeof(T));
 }
 
-/// @brief This function benchmarks the tuvx tridiagonal matrix solver for single precision
-/// @param state Benchmarking argument
-static void BM_TUVX_DOUBLE_PRECISISON(benchmark::State& state)
+/// @brief Solves a tridiagonal system with LAPACKE
+inline void LapackeSolve(tuvx::TridiagonalMatrix<double>& A, std::vector<double>& b)
 {
-  std::vector<double> x(SYSTEM_SIZE);
-  std::vector<double> b(SYSTEM_SIZE);
-  tuvx::TridiagonalMatrix<double> A(SYSTEM_SIZE);
-  std::vector<double> x_approx(SYSTEM_SIZE);
+  LAPACKE_dgtsv(
+      LAPACK_ROW_MAJOR,
+      b.size(),
+      1,
+      A.lower_diagonal_.data(),
+      A.main_diagonal_.data(),
+      A.upper_diagonal_.data(),
+      b.data(),
+      1);
+}
 
-  for (auto _ : state)
-  {
-    state.PauseTiming();
-    tuvx::FillRandom<double>(A, RANDOM_NUMBER_SEED, MAKE_DIAGONALLY_DOMINANT);
-    tuvx::FillRandom<double>(x, RANDOM_NUMBER_SEED);
-    state.ResumeTiming();
-    tuvx::Solve<double>(A, b);
-  }
+/// @brief Solves a tridiagonal system with LAPACKE
+inline void LapackeSolve(tuvx::TridiagonalMatrix<float>& A, std::vector<float>& b)
+{
+  LAPACKE_sgtsv(
+      LAPACK_ROW_MAJOR,
+      b.size(),
+      1,
+      A.lower_diagonal_.data(),
+      A.main_diagonal_.data(),
+      A.upper_diagonal_.data(),
+      b.data(),
+      1);
 }
 
-/// @brief This function benchmarks the tuvx tridiagonal matrix solver for double precision
-/// @param state Benchmarking argument
-static void BM_TUVX_SINGLE_PRECISISON(benchmark::State& state)
+/// @brief This function benchmarks the lapacke tridiagonal matrix solver
+/// @param state Benchmarking argument (layers, columns)
+template<typename T>
+static void BM_LAPACKE(benchmark::State& state)
 {
-  std::vector<float> x(SYSTEM_SIZE);
-  std::vector<float> b(SYSTEM_SIZE);
-  tuvx::TridiagonalMatrix<float> A(SYSTEM_SIZE);
-  std::vector<float> x_approx(SYSTEM_SIZE);
+  TimeBatches<T>(
+      state,
+      [](Batch<T>& batch)
+      {
+        for (std::size_t i = 0; i < batch.b_.size(); i++)
+        {
+          LapackeSolve(batch.A_[i], batch.b_[i]);
+        }
+      });
+}
 
-  // Perform setup here
-  for (auto _ : state)
+/// @brief This function benchmarks the tuvx tridiagonal matrix solver
+/// @param state Benchmarking argument (layers, columns)
+template<typename T>
+static void BM_TUVX(benchmark::State& state)
+{
+  TimeBatches<T>(
+      state,
+      [](Batch<T>& batch)
+      {
+        for (std::size_t i = 0; i < batch.b_.size(); i++)
+        {
+          tuvx::Solve<T>(batch.A_[i], batch.b_[i]);
+        }
+      });
+}
+
+/// @brief This function benchmarks the tuvx mixed-precision tridiagonal matrix solver
+/// @param state Benchmarking argument (layers, columns, refinement steps)
+static void BM_TUVX_MIXED_PRECISION(benchmark::State& state)
+{
+  const std::size_t refinement_steps = state.range(2);
+  TimeBatches<double>(
+      state,
+      [refinement_steps](Batch<double>& batch)
+      {
+        for (std::size_t i = 0; i < batch.b_.size(); i++)
+        {
+          tuvx::SolveMixedPrecision<double>(batch.A_[i], batch.b_[i], refinement_steps);
+        }
+      });
+}
+
+/// @brief This function benchmarks the instruction-set variants of the tuvx tridiagonal
+/// matrix solver
+/// @param state Benchmarking argument (layers, columns, tuvx::InstructionSet to use)
+template<typename T>
+static void BM_TUVX_DISPATCH(benchmark::State& state)
+{
+  const auto isa = static_cast<tuvx::InstructionSet>(state.range(2));
+  if (!tuvx::IsSupported(isa))
   {
-    state.PauseTiming();
-    tuvx::FillRandom<float>(A, RANDOM_NUMBER_SEED, MAKE_DIAGONALLY_DOMINANT);
-    tuvx::FillRandom<float>(x, RANDOM_NUMBER_SEED);
-    b = tuvx::Dot<float>(A, x);
-    state.ResumeTiming();
-    tuvx::Solve<float>(A, b);
+    state.SkipWithError("instruction set not supported");
+    return;
   }
+  state.SetLabel(tuvx::InstructionSetName(isa));
+  TimeBatches<T>(
+      state,
+      [isa](Batch<T>& batch)
+      {
+        for (std::size_t i = 0; i < batch.b_.size(); i++)
+        {
+          tuvx::dispatch::Solve(isa, batch.A_[i], batch.b_[i]);
+        }
+      });
+}
+
+/// @brief Sweeps the system sizes and batch sizes
+static void Sweep(benchmark::internal::Benchmark* b)
+{
+  b->ArgNames({ "layers", "columns" })->ArgsProduct({ NUMBER_OF_LAYERS, NUMBER_OF_COLUMNS })->UseManualTime();
+}
+
+/// @brief Sweeps the system sizes and batch sizes for each number of refinement steps
+static void SweepRefinementSteps(benchmark::internal::Benchmark* b)
+{
+  b->ArgNames({ "layers", "columns", "steps" })
+      ->ArgsProduct({ NUMBER_OF_LAYERS, NUMBER_OF_COLUMNS, { 1, 2 } })
+      ->UseManualTime();
+}
+
+/// @brief Sweeps the system sizes and batch sizes for each instruction set
+static void SweepInstructionSets(benchmark::internal::Benchmark* b)
+{
+  b->ArgNames({ "layers", "columns", "isa" })
+      ->ArgsProduct({ NUMBER_OF_LAYERS, NUMBER_OF_COLUMNS, { 0, 1, 2 } })
+      ->UseManualTime();
 }
 
 /// @brief Register the functions defined above as a benchmark
-BENCHMARK(BM_LAPACKE_DOUBLE_PRECISISON);
-BENCHMARK(BM_LAPACKE_SINGLE_PRECISISON);
-BENCHMARK(BM_TUVX_DOUBLE_PRECISISON);
-BENCHMARK(BM_TUVX_SINGLE_PRECISISON);
+BENCHMARK_TEMPLATE(BM_LAPACKE, double)->Apply(Sweep);
+BENCHMARK_TEMPLATE(BM_LAPACKE, float)->Apply(Sweep);
+BENCHMARK_TEMPLATE(BM_TUVX, double)->Apply(Sweep);
+BENCHMARK_TEMPLATE(BM_TUVX, float)->Apply(Sweep);
+BENCHMARK(BM_TUVX_MIXED_PRECISION)->Apply(SweepRefinementSteps);
+BENCHMARK_TEMPLATE(BM_TUVX_DISPATCH, double)->Apply(SweepInstructionSets);
+BENCHMARK_TEMPLATE(BM_TUVX_DISPATCH, float)->Apply(SweepInstructionSets);
 
 /// @brief Run all benchmarks
 BENCHMARK_MAIN();
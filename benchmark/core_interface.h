@@ -0,0 +1,55 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// C interface to the TUV-x core for the end-to-end benchmarks
+// (core_interface.F90)
+#pragma once
+
+#include <cstdint>
+
+extern "C"
+{
+  /// @brief Initializes MPI (when TUV-x is built with MPI support)
+  void BenchmarkInitialize();
+
+  /// @brief Finalizes MPI (when TUV-x is built with MPI support)
+  void BenchmarkFinalize();
+
+  /// @brief Builds a core from a configuration file with the given solver
+  ///
+  /// The radiative transfer solver in the configuration is replaced, and stage
+  /// timing is turned on.
+  /// @param config_path Path to the TUV-x configuration file
+  /// @param solver_type "delta eddington" or "discrete ordinate"
+  /// @param number_of_streams Number of discrete ordinate streams (ignored if 0)
+  /// @return Handle to the core
+  void* BenchmarkCoreCreate(const char* config_path, const char* solver_type, int number_of_streams);
+
+  /// @brief Calculates one column
+  /// @param core Handle to the core
+  /// @param solar_zenith_angle Solar zenith angle [degrees]
+  /// @param all_rates Whether to calculate dose and heating rates as well as photolysis rates
+  void BenchmarkCoreRun(void* core, double solar_zenith_angle, bool all_rates);
+
+  /// @brief Clears the accumulated stage times
+  /// @param core Handle to the core
+  void BenchmarkCoreResetTimings(void* core);
+
+  /// @brief Collects the accumulated stage times
+  /// @param core Handle to the core
+  /// @return Number of timed stages
+  int BenchmarkCoreNumberOfStages(void* core);
+
+  /// @brief Returns a stage collected by BenchmarkCoreNumberOfStages()
+  /// @param core Handle to the core
+  /// @param index Stage index
+  /// @param label Buffer for the null-terminated stage label
+  /// @param label_length Size of the label buffer
+  /// @param seconds Accumulated time [s]
+  /// @param calls Number of times the stage was timed
+  void BenchmarkCoreGetStage(void* core, int index, char* label, int label_length, double* seconds, int64_t* calls);
+
+  /// @brief Frees a core
+  /// @param core Handle to the core
+  void BenchmarkCoreDelete(void* core);
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// C interface to the TUV-x interpolators for the interpolation benchmarks
+// (interpolate_interface.F90)
+#pragma once
+
+extern "C"
+{
+  /// @brief Builds an interpolator and a regridding problem for it
+  ///
+  /// Rows of smooth source data on an evenly spaced grid from 100 to 800 nm
+  /// are interpolated onto an evenly spaced target grid from 120 to 735 nm.
+  /// @param interpolator_type "linear", "conserving", "fractional source", or "fractional target"
+  /// @param number_of_source_points Number of source grid points
+  /// @param number_of_target_points Number of target grid points (section edges)
+  /// @param number_of_rows Number of source data rows interpolated on each run
+  /// @return Handle to the interpolator
+  void* BenchmarkInterpolatorCreate(
+      const char* interpolator_type,
+      int number_of_source_points,
+      int number_of_target_points,
+      int number_of_rows);
+
+  /// @brief Interpolates each row of source data onto the target grid
+  /// @param interpolator Handle to the interpolator
+  void BenchmarkInterpolatorRun(void* interpolator);
+
+  /// @brief Frees an interpolator
+  /// @param interpolator Handle to the interpolator
+  void BenchmarkInterpolatorDelete(void* interpolator);
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// C interface to individual TUV-x column kernels for the kernel benchmarks
+// (kernels_interface.F90)
+#pragma once
+
+extern "C"
+{
+  /// @brief Builds the kernels from the la_srb test data
+  ///
+  /// The grids, profiles, and Lyman-alpha/Schumann-Runge band parameterization
+  /// are configured by test/data/la_srb_bands.config.json, with the height grid
+  /// divided into the given number of layers. The spherical geometry is set up
+  /// for an overhead sun.
+  /// @param number_of_layers Number of layers in the height grid
+  /// @param cross_section_config_path Cross section test configuration whose first cross section is built (none if empty)
+  /// @return Handle to the kernels
+  void* BenchmarkKernelsCreate(int number_of_layers, const char* cross_section_config_path);
+
+  /// @brief Updates the spherical geometry for a solar zenith angle (spherical_geometry_t%set_parameters)
+  /// @param kernels Handle to the kernels
+  /// @param solar_zenith_angle Solar zenith angle [degrees]
+  void BenchmarkKernelsSetZenithAngle(void* kernels, double solar_zenith_angle);
+
+  /// @brief Calculates the vertical and slant air columns (spherical_geometry_t%air_mass)
+  /// @param kernels Handle to the kernels
+  void BenchmarkKernelsAirMass(void* kernels);
+
+  /// @brief Calculates the O2 optical depths in the Lyman-alpha and SR bands (la_sr_bands_t%optical_depth)
+  /// @param kernels Handle to the kernels
+  void BenchmarkKernelsLaSrbOpticalDepth(void* kernels);
+
+  /// @brief Calculates the O2 cross sections in the Lyman-alpha and SR bands (la_sr_bands_t%cross_section)
+  /// @param kernels Handle to the kernels
+  void BenchmarkKernelsLaSrbCrossSection(void* kernels);
+
+  /// @brief Calculates the cross section built by BenchmarkKernelsCreate() (cross_section_t%calculate)
+  /// @param kernels Handle to the kernels
+  void BenchmarkKernelsCrossSection(void* kernels);
+
+  /// @brief Frees the kernels
+  /// @param kernels Handle to the kernels
+  void BenchmarkKernelsDelete(void* kernels);
+}
@@ -0,0 +1,130 @@
+# Copyright (C) 2024 National Center for Atmospheric Research
+# SPDX-License-Identifier: Apache-2.0
+#
+# Performance-regression gate for the Google Benchmark executables
+#
+# Runs a benchmark executable with a fixed number of repetitions, writes the
+# Google Benchmark JSON output, and compares the median time of each benchmark
+# with a stored baseline file. A benchmark has regressed when its median time
+# has grown by more than the threshold or, for noisy benchmarks, by more than
+# the noise factor times the larger coefficient of variation of the two runs.
+#
+# The gate also fails when no benchmarks ran (e.g., the filter matches none)
+# or when benchmarks in the baseline did not run (e.g., they were renamed).
+#
+# With --update, the output replaces the baseline instead. If the baseline
+# does not exist, the gate is skipped (exit code 77).
+import argparse
+import json
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+
+SKIP_RETURN_CODE = 77
+
+SECONDS_PER_UNIT = { "ns": 1.0e-9, "us": 1.0e-6, "ms": 1.0e-3, "s": 1.0 }
+
+def load_times(path):
+    """Returns the times of each repetition of each benchmark [s]"""
+    with open(path) as f:
+        report = json.load(f)
+    times = {}
+    for run in report["benchmarks"]:
+        if run.get("run_type", "iteration") != "iteration" or "error_occurred" in run:
+            continue
+        name = run.get("run_name", run["name"])
+        seconds = run["real_time"] * SECONDS_PER_UNIT[run.get("time_unit", "ns")]
+        times.setdefault(name, []).append(seconds)
+    return times
+
+def summarize(times):
+    """Returns the median and coefficient of variation of a set of times"""
+    median = statistics.median(times)
+    if len(times) < 2 or median == 0.0:
+        return median, 0.0
+    return median, statistics.stdev(times) / statistics.mean(times)
+
+def compare(baseline, current, threshold, noise_factor):
+    """Returns the regressions, the benchmarks missing from the baseline, and
+    the baseline benchmarks that did not run"""
+    regressions = []
+    missing = []
+    removed = sorted(name for name in baseline if name not in current)
+    for name, times in current.items():
+        if name not in baseline:
+            missing.append(name)
+            continue
+        base_median, base_cv = summarize(baseline[name])
+        median, cv = summarize(times)
+        if base_median == 0.0:
+            continue
+        change = median / base_median - 1.0
+        allowed = max(threshold, noise_factor * max(base_cv, cv))
+        if change > allowed:
+            regressions.append((change, allowed, name, base_median, median))
+    regressions.sort(reverse=True)
+    return regressions, missing, removed
+
+def print_regressions(regressions, number_of_benchmarks, max_report):
+    print(f"{len(regressions)} of {number_of_benchmarks} benchmarks regressed")
+    print(f"{'benchmark':<60} {'baseline [s]':>12} {'current [s]':>12} {'change':>9} {'allowed':>9}")
+    for change, allowed, name, base_median, median in regressions[:max_report]:
+        print(f"{name:<60} {base_median:>12.4e} {median:>12.4e} "
+              f"{100.0 * change:>+8.1f}% {100.0 * allowed:>8.1f}%")
+    if len(regressions) > max_report:
+        print(f"... and {len(regressions) - max_report} more")
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare Google Benchmark results with a baseline")
+    parser.add_argument("--benchmark", required=True, help="benchmark executable")
+    parser.add_argument("--baseline", required=True, help="baseline JSON file")
+    parser.add_argument("--output", required=True, help="JSON file for the results of this run")
+    parser.add_argument("--filter", default="", help="regular expression selecting the benchmarks to run")
+    parser.add_argument("--repetitions", type=int, default=5, help="repetitions of each benchmark")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="smallest relative slowdown reported as a regression")
+    parser.add_argument("--noise-factor", type=float, default=3.0,
+                        help="coefficients of variation a slowdown must exceed to be a regression")
+    parser.add_argument("--max-report", type=int, default=10, help="regressions to list")
+    parser.add_argument("--update", action="store_true", help="replace the baseline with this run")
+    args = parser.parse_args()
+
+    if not args.update and not os.path.isfile(args.baseline):
+        print(f"No baseline at {args.baseline}; build the perf_baselines target to create one")
+        return SKIP_RETURN_CODE
+
+    command = [ args.benchmark,
+                f"--benchmark_repetitions={args.repetitions}",
+                f"--benchmark_out={args.output}",
+                "--benchmark_out_format=json" ]
+    if args.filter:
+        command.append(f"--benchmark_filter={args.filter}")
+    result = subprocess.run(command)
+    if result.returncode != 0:
+        print(f"{args.benchmark} failed with exit code {result.returncode}")
+        return 1
+
+    current = load_times(args.output)
+    if not current:
+        print(f"No benchmarks ran; check the filter '{args.filter}'")
+        return 1
+
+    if args.update:
+        os.makedirs(os.path.dirname(os.path.abspath(args.baseline)), exist_ok=True)
+        shutil.copyfile(args.output, args.baseline)
+        print(f"Updated {args.baseline}")
+        return 0
+
+    baseline = load_times(args.baseline)
+    regressions, missing, removed = compare(baseline, current, args.threshold, args.noise_factor)
+    for name in missing:
+        print(f"{name} is not in the baseline")
+    for name in removed:
+        print(f"{name} is in the baseline but did not run")
+    print_regressions(regressions, len(current) - len(missing), args.max_report)
+    return 1 if regressions or removed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
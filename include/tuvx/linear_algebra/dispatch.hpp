@@ -0,0 +1,67 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Tridiagonal kernels compiled for several instruction sets, selected at run time
+#pragma once
+
+#include <tuvx/linear_algebra/linear_algebra.hpp>
+#include <tuvx/util/cpu_dispatch.hpp>
+
+#include <vector>
+
+namespace tuvx
+{
+  namespace dispatch
+  {
+
+    /// @brief Solves a tridiagonal system with the kernel for an instruction set.
+    /// See tuvx::Solve(). Unsupported instruction sets fall back to the baseline kernel.
+    /// @param isa Instruction set
+    /// @param A Tridiagonal coeffcient matrix
+    /// @param b Right hand side vector of the tridiagonal system.
+    void Solve(InstructionSet isa, TridiagonalMatrix<double> &A, std::vector<double> &b);
+    void Solve(InstructionSet isa, TridiagonalMatrix<float> &A, std::vector<float> &b);
+
+    /// @brief Mixed-precision tridiagonal solve with the kernel for an instruction set.
+    /// See tuvx::SolveMixedPrecision(). Unsupported instruction sets fall back to the baseline kernel.
+    /// @param isa Instruction set
+    /// @param A Tridiagonal coefficient matrix (not modified)
+    /// @param b Right hand side vector of the tridiagonal system.
+    /// @param refinement_steps Number of iterative refinement steps
+    void SolveMixedPrecision(
+        InstructionSet isa,
+        const TridiagonalMatrix<double> &A,
+        std::vector<double> &b,
+        const std::size_t &refinement_steps = 2);
+
+    /// @brief Tridiagonal matrix-vector product with the kernel for an instruction set.
+    /// See tuvx::Dot(). Unsupported instruction sets fall back to the baseline kernel.
+    /// @param isa Instruction set
+    /// @param A Tridiagonal matrix
+    /// @param x Vector to multiply the matrix with
+    std::vector<double> Dot(InstructionSet isa, const TridiagonalMatrix<double> &A, const std::vector<double> &x);
+    std::vector<float> Dot(InstructionSet isa, const TridiagonalMatrix<float> &A, const std::vector<float> &x);
+
+    /// @brief Solves a tridiagonal system with the kernel for SelectedInstructionSet()
+    template<typename T>
+    inline void Solve(TridiagonalMatrix<T> &A, std::vector<T> &b)
+    {
+      Solve(SelectedInstructionSet(), A, b);
+    }
+
+    /// @brief Mixed-precision tridiagonal solve with the kernel for SelectedInstructionSet()
+    inline void
+    SolveMixedPrecision(const TridiagonalMatrix<double> &A, std::vector<double> &b, const std::size_t &refinement_steps = 2)
+    {
+      SolveMixedPrecision(SelectedInstructionSet(), A, b, refinement_steps);
+    }
+
+    /// @brief Tridiagonal matrix-vector product with the kernel for SelectedInstructionSet()
+    template<typename T>
+    inline std::vector<T> Dot(const TridiagonalMatrix<T> &A, const std::vector<T> &x)
+    {
+      return Dot(SelectedInstructionSet(), A, x);
+    }
+
+  }  // namespace dispatch
+}  // namespace tuvx
@@ -19,7 +19,7 @@ namespace tuvx
     std::vector<T> main_diagonal_;   // main diagonal
     /// @brief Initializes the three internal vectors based on
     /// size. Main diagonal will be of size $n$, while the upper/lower
-    /// diagonals will be of size $n-1$
+    /// diagonals will be of size $n-1$ (or empty when $n$ is 0)
     /// @param size Size of the matrix to be initialized
     TridiagonalMatrix(std::size_t size);
   };
@@ -38,6 +38,14 @@ namespace tuvx
   template<typename T>
   void FillRandom(TridiagonalMatrix<T> &A, const unsigned &seed, const bool &make_diagonally_dominant = false);
 
+  /// @brief Fills a matrix with the coefficients of a two-stream radiative transfer system.
+  /// The rows follow the delta-Eddington matrix setup (Toon et al., 1989, equations 39-43)
+  /// for layers with random optical depths, single scattering albedos, and asymmetry factors.
+  /// @param A Tridiagonal matrix to fill. Its size must be even (two rows per layer)
+  /// @param seed Seed for random number generation
+  template<typename T>
+  void FillTwoStream(TridiagonalMatrix<T> &A, const unsigned &seed);
+
   /// @brief Displays the data stored inside a std::vector
   /// @param x Vector to print
   template<typename T>
@@ -56,6 +64,19 @@ namespace tuvx
   template<typename T>
   void Solve(TridiagonalMatrix<T> &A, std::vector<T> &b);
 
+  /// @brief Mixed-precision solver for tridiagonal linear systems (A x = b).
+  /// The system is factored and solved in the lower precision L, and the solution is then
+  /// improved with iterative refinement, using residuals calculated in the working
+  /// precision T. For well-conditioned systems, one or two refinement steps are enough to
+  /// reach the accuracy of a solve in the working precision. The solution is stored in b.
+  /// Single-equation systems are solved directly in the working precision, and empty
+  /// systems are left unchanged.
+  /// @param A Tridiagonal coefficient matrix (not modified)
+  /// @param b Right hand side vector of the tridiagonal system.
+  /// @param refinement_steps Number of iterative refinement steps
+  template<typename T, typename L = float>
+  void SolveMixedPrecision(const TridiagonalMatrix<T> &A, std::vector<T> &b, const std::size_t &refinement_steps = 2);
+
   /// @brief Specialized dot product function for tridiagonal matrices.
   /// @param A Tridiagonal matrix
   /// @param x Vector to multiply the matrix with
@@ -1,4 +1,5 @@
 
+#include <cmath>
 #include <random>
 namespace tuvx
 {
@@ -8,8 +9,8 @@ namespace tuvx
   {
     this->size_ = size;
     this->main_diagonal_ = std::vector<T>(size);
-    this->upper_diagonal_ = std::vector<T>(size - 1);
-    this->lower_diagonal_ = std::vector<T>(size - 1);
+    this->upper_diagonal_ = std::vector<T>(size > 0 ? size - 1 : 0);
+    this->lower_diagonal_ = std::vector<T>(size > 0 ? size - 1 : 0);
   }
 
   template<typename T>
@@ -52,6 +53,69 @@ namespace tuvx
     }
   }
 
+  template<typename T, typename L>
+  inline void SolveMixedPrecision(const TridiagonalMatrix<T> &A, std::vector<T> &b, const std::size_t &refinement_steps)
+  {
+    std::size_t N = b.size();
+    // there are no off-diagonal elements to factor or refine
+    if (N == 0)
+    {
+      return;
+    }
+    if (N == 1)
+    {
+      b[0] /= A.main_diagonal_[0];
+      return;
+    }
+    // factor in the lower precision
+    std::vector<L> lower(N);
+    std::vector<L> main(N);
+    std::vector<L> upper(N);
+    main[0] = (L)A.main_diagonal_[0];
+    for (std::size_t i = 1; i < N; i++)
+    {
+      upper[i - 1] = (L)A.upper_diagonal_[i - 1];
+      lower[i] = (L)A.lower_diagonal_[i - 1] / main[i - 1];
+      main[i] = (L)A.main_diagonal_[i] - lower[i] * upper[i - 1];
+    }
+    // solves L U y = r in the lower precision, storing the result in y
+    std::vector<L> y(N);
+    auto solve_factored = [&](const std::vector<T> &r)
+    {
+      y[0] = (L)r[0];
+      for (std::size_t i = 1; i < N; i++)
+      {
+        y[i] = (L)r[i] - lower[i] * y[i - 1];
+      }
+      y[N - 1] = y[N - 1] / main[N - 1];
+      for (std::size_t i = N - 1; i-- > 0;)
+      {
+        y[i] = (y[i] - upper[i] * y[i + 1]) / main[i];
+      }
+    };
+
+    solve_factored(b);
+    std::vector<T> x(y.begin(), y.end());
+    std::vector<T> residual(N);
+    for (std::size_t step = 0; step < refinement_steps; step++)
+    {
+      // residual b - A x in the working precision (see Dot)
+      residual[0] = b[0] - (A.main_diagonal_[0] * x[0] + A.upper_diagonal_[0] * x[1]);
+      for (std::size_t i = 1; i < N - 1; i++)
+      {
+        residual[i] =
+            b[i] - (A.main_diagonal_[i] * x[i] + A.upper_diagonal_[i] * x[i + 1] + A.lower_diagonal_[i - 1] * x[i - 1]);
+      }
+      residual[N - 1] = b[N - 1] - (A.main_diagonal_[N - 1] * x[N - 1] + A.lower_diagonal_[N - 2] * x[N - 2]);
+      solve_factored(residual);
+      for (std::size_t i = 0; i < N; i++)
+      {
+        x[i] += (T)y[i];
+      }
+    }
+    b = x;
+  }
+
   template<typename T>
   inline void FillRandom(std::vector<T> &x, const unsigned &seed)
   {
@@ -85,6 +149,56 @@ namespace tuvx
     }
   }
 
+  template<typename T>
+  inline void FillTwoStream(TridiagonalMatrix<T> &A, const unsigned &seed)
+  {
+    std::mt19937 random_device(seed);
+    std::uniform_real_distribution<double> log_optical_depth(-3.0, 1.0);
+    std::uniform_real_distribution<double> single_scattering_albedo(0.0, 0.99);
+    std::uniform_real_distribution<double> asymmetry_factor(0.0, 0.9);
+    std::uniform_real_distribution<double> surface_albedo(0.0, 1.0);
+
+    // e1 - e4 from Toon et al. (1989) equation 44 for each layer
+    std::size_t n_layers = A.size_ / 2;
+    std::vector<double> e1(n_layers), e2(n_layers), e3(n_layers), e4(n_layers);
+    for (std::size_t i = 0; i < n_layers; i++)
+    {
+      double tau = std::pow(10.0, log_optical_depth(random_device));
+      double om = single_scattering_albedo(random_device);
+      double g = asymmetry_factor(random_device);
+      double gam1 = (7.0 - om * (4.0 + 3.0 * g)) / 4.0;
+      double gam2 = -(1.0 - om * (4.0 - 3.0 * g)) / 4.0;
+      double lam = std::sqrt(gam1 * gam1 - gam2 * gam2);
+      double bgam = gam2 != 0.0 ? (gam1 - lam) / gam2 : 0.0;
+      double expon = std::exp(-lam * tau);
+      e1[i] = 1.0 + bgam * expon;
+      e2[i] = 1.0 - bgam * expon;
+      e3[i] = bgam + expon;
+      e4[i] = bgam - expon;
+    }
+
+    // rows from Toon et al. (1989) equations 39 - 43
+    std::size_t last = A.size_ - 1;
+    A.main_diagonal_[0] = (T)e1[0];
+    A.upper_diagonal_[0] = (T)(-e2[0]);
+    for (std::size_t i = 0; i + 1 < n_layers; i++)
+    {
+      // even rows in the equations
+      std::size_t row = 2 * i + 1;
+      A.lower_diagonal_[row - 1] = (T)(e2[i + 1] * e1[i] - e3[i] * e4[i + 1]);
+      A.main_diagonal_[row] = (T)(e2[i] * e2[i + 1] - e4[i] * e4[i + 1]);
+      A.upper_diagonal_[row] = (T)(e1[i + 1] * e4[i + 1] - e2[i + 1] * e3[i + 1]);
+      // odd rows in the equations
+      row = 2 * i + 2;
+      A.lower_diagonal_[row - 1] = (T)(e2[i] * e3[i] - e4[i] * e1[i]);
+      A.main_diagonal_[row] = (T)(e1[i] * e1[i + 1] - e3[i] * e3[i + 1]);
+      A.upper_diagonal_[row] = (T)(e3[i] * e4[i + 1] - e1[i] * e2[i + 1]);
+    }
+    double rsfc = surface_albedo(random_device);
+    A.lower_diagonal_[last - 1] = (T)(e1[n_layers - 1] - rsfc * e3[n_layers - 1]);
+    A.main_diagonal_[last] = (T)(e2[n_layers - 1] - rsfc * e4[n_layers - 1]);
+  }
+
   template<typename T>
   inline void Print(const std::vector<T> &x)
   {
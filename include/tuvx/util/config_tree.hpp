@@ -0,0 +1,126 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tuvx
+{
+
+  /// @brief Flat, immutable index over a parsed YAML document
+  /// @details The document is compiled once into a single array of nodes in
+  ///          which the children of each map or sequence are stored
+  ///          contiguously. Map keys are interned and child lookup by key
+  ///          goes through an open-addressing hash table, so finding and
+  ///          iterating over nodes does not allocate.
+  ///
+  ///          The original YAML nodes are kept alongside the index and are
+  ///          used for value conversion and output, so values read from the
+  ///          tree are identical to those read directly with yaml-cpp. These
+  ///          are handles that refer to the parsed document, one per node,
+  ///          rather than copies of it.
+  class ConfigTree
+  {
+   public:
+    /// @brief Index returned when a node is not found
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    enum class NodeType
+    {
+      Null,
+      Scalar,
+      Sequence,
+      Map
+    };
+
+    /// @brief Compiles a parsed YAML document
+    /// @param root root node of the document
+    explicit ConfigTree(const YAML::Node& root);
+
+    /// @brief Returns the index of the root node
+    std::size_t Root() const
+    {
+      return 0;
+    }
+
+    /// @brief Returns the total number of nodes in the tree
+    std::size_t NumberOfNodes() const
+    {
+      return nodes_.size();
+    }
+
+    /// @brief Returns the type of a node
+    NodeType Type(std::size_t node) const
+    {
+      return nodes_[node].type_;
+    }
+
+    /// @brief Returns the number of children of a map or sequence node
+    std::size_t NumberOfChildren(std::size_t node) const
+    {
+      return nodes_[node].number_of_children_;
+    }
+
+    /// @brief Returns the index of the parent of a node (npos for the root)
+    std::size_t Parent(std::size_t node) const
+    {
+      return nodes_[node].parent_;
+    }
+
+    /// @brief Returns the index of the first child of a node
+    /// @details Children occupy indices [FirstChild, FirstChild + NumberOfChildren)
+    std::size_t FirstChild(std::size_t node) const
+    {
+      return nodes_[node].first_child_;
+    }
+
+    /// @brief Finds the child of a map node with a given key
+    /// @param node parent node
+    /// @param key key to find
+    /// @return index of the child node, or npos if not found
+    std::size_t Find(std::size_t node, const char* key) const;
+
+    /// @brief Counts the children of a map node with a given key
+    /// @details This is more than one only for keys that are duplicated in
+    ///          the document
+    std::size_t Count(std::size_t node, const char* key) const;
+
+    /// @brief Returns the key of a map entry (empty for other nodes)
+    const std::string& Key(std::size_t node) const
+    {
+      return keys_[nodes_[node].key_];
+    }
+
+    /// @brief Returns the YAML node a tree node was compiled from
+    const YAML::Node& Source(std::size_t node) const
+    {
+      return sources_[node];
+    }
+
+   private:
+    struct Node
+    {
+      NodeType type_;
+      std::size_t parent_;
+      std::size_t key_;
+      std::size_t first_child_;
+      std::size_t number_of_children_;
+    };
+
+    void Compile(std::size_t node, std::unordered_map<std::string, std::size_t>& key_ids);
+    void BuildIndex();
+    static std::uint64_t Hash(std::size_t parent, const char* key);
+
+    std::vector<Node> nodes_;
+    std::vector<YAML::Node> sources_;
+    std::vector<std::string> keys_;
+    std::vector<std::size_t> slots_;
+  };
+
+}  // namespace tuvx
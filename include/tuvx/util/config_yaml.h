@@ -5,12 +5,48 @@
 #include <cstddef>
 
 #ifdef __cplusplus
+  #include <tuvx/util/config_tree.hpp>
   #include <yaml-cpp/yaml.h>
 
+  #include <memory>
+
+/// @brief Mutable state shared by the handles to one parsed document
+struct YamlDocument;
+
+/// @brief Handle to a YAML node
+/// @details Parsed documents are compiled into an immutable tuvx::ConfigTree
+///          and handles to their nodes are views into the shared tree, so
+///          getting or copying a sub-node does not copy any data. The first
+///          time a handle is modified, only the subtree it refers to is
+///          cloned. Handles into that subtree switch to the clone and lookups
+///          from handles above it find the clone, so changes made through
+///          one handle are seen through the others, as for YAML nodes, while
+///          the rest of the document stays shared and read-only.
+///          Each handle is itself a small heap object, as Fortran holds it
+///          by pointer; string and plain numeric values are read from the
+///          tree without further allocation.
+///          Copies made with YamlCopyNode start a new document and are not
+///          affected. Handles to documents built up with the YamlAdd*
+///          functions hold their YAML node directly.
+struct Yaml
+{
+  std::shared_ptr<const tuvx::ConfigTree> tree_;
+  std::shared_ptr<YamlDocument> document_;
+  std::size_t index_ = 0;
+  YAML::Node node_;
+};
+
+/// @brief Iterator over the children of a YAML node
+struct YamlIterator
+{
+  std::shared_ptr<const tuvx::ConfigTree> tree_;
+  std::shared_ptr<YamlDocument> document_;
+  std::size_t index_ = 0;
+  YAML::iterator iter_;
+};
+
 extern "C"
 {
-  typedef YAML::Node Yaml;
-  typedef YAML::iterator YamlIterator;
 #endif
 
   /// @brief Interoperatble string type
@@ -62,6 +98,19 @@ extern "C"
   /// @return number of node elements
   int YamlSize(Yaml* node);
 
+  /// @brief Counts the entries of a map node with a given key
+  /// @param node YAML node
+  /// @param key key to search for
+  /// @return number of entries with the key (more than one if the key is
+  ///         duplicated in the document)
+  int YamlCountKey(Yaml* node, const char* key);
+
+  /// @brief Counts the keys of a map node that do not start with a prefix
+  /// @param node YAML node
+  /// @param ignore_prefix keys starting with this prefix are not counted
+  /// @return number of keys
+  int YamlCountKeys(Yaml* node, const char* ignore_prefix);
+
   /// @brief Returns an iterator to the first child node
   /// @param node YAML node to iterate over
   /// @return beginning iterator
@@ -85,6 +134,7 @@ extern "C"
   bool YamlAtEnd(YamlIterator* iter, YamlIterator* end);
 
   /// @brief Returns the key associated with a YAML iterator
+  /// @details The returned string is owned by the node and must not be freed
   /// @param iter YAML iterator to return key for
   /// @return key as a c string
   StringT YamlKey(YamlIterator* iter);
@@ -97,6 +147,7 @@ extern "C"
   Yaml* YamlGetNode(Yaml* node, const char* key, bool& found);
 
   /// @brief Gets a string from a YAML node
+  /// @details The returned string is owned by the node and must not be freed
   /// @param node YAML node
   /// @param key key to search for
   /// @param found true if successful, false otherwise
@@ -132,6 +183,8 @@ extern "C"
   bool YamlGetBool(Yaml* node, const char* key, bool& found);
 
   /// @brief Gets an array of strings from a YAML node
+  /// @details The strings in the array are owned by the node. Only the array
+  ///          itself should be freed, with YamlDeleteStringArray
   /// @param node YAML node
   /// @param key key to search for
   /// @param found true if successful, false otherwise
@@ -145,6 +198,30 @@ extern "C"
   /// @return double array
   DoubleArrayT YamlGetDoubleArray(Yaml* node, const char* key, bool& found);
 
+  /// @brief Gets the number of elements in an array in a YAML node
+  /// @details Used with YamlFillDoubleArray or YamlFillStringArray to read
+  ///          an array directly into a caller-allocated buffer
+  /// @param node YAML node
+  /// @param key key to search for
+  /// @param found true if successful, false otherwise
+  /// @return number of elements in the array
+  int YamlGetArraySize(Yaml* node, const char* key, bool& found);
+
+  /// @brief Reads an array of doubles from a YAML node into a buffer
+  /// @param node YAML node
+  /// @param key key to search for
+  /// @param buffer caller-allocated buffer
+  /// @param size number of elements to read (at most the array size)
+  void YamlFillDoubleArray(Yaml* node, const char* key, double* buffer, int size);
+
+  /// @brief Reads an array of strings from a YAML node into a buffer
+  /// @details The strings are owned by the node and should not be freed
+  /// @param node YAML node
+  /// @param key key to search for
+  /// @param buffer caller-allocated buffer
+  /// @param size number of elements to read (at most the array size)
+  void YamlFillStringArray(Yaml* node, const char* key, StringT* buffer, int size);
+
   /// @brief Gets an array of YAML nodes from a YAML node
   /// @details It is expected that the caller takes ownership of the individual
   ///          pointers to YAML nodes in the array
@@ -160,6 +237,7 @@ extern "C"
   Yaml* YamlGetNodeFromIterator(YamlIterator* iter);
 
   /// @brief Gets a string from a YAML iterator
+  /// @details The returned string is owned by the node and must not be freed
   /// @param iter YAML iterator
   /// @return string as a c string
   StringT YamlGetStringFromIterator(YamlIterator* iter);
@@ -185,6 +263,8 @@ extern "C"
   bool YamlGetBoolFromIterator(YamlIterator* iter);
 
   /// @brief Gets an array of strings from a YAML iterator
+  /// @details The strings in the array are owned by the node. Only the array
+  ///          itself should be freed, with YamlDeleteStringArray
   /// @param iter YAML iterator
   /// @return string array
   StringArrayT YamlGetStringArrayFromIterator(YamlIterator* iter);
@@ -244,6 +324,8 @@ extern "C"
   void YamlAddNodeArray(Yaml* node, const char* key, NodeArrayT value);
 
   /// @brief Copies a YAML node
+  /// @details Copies of compiled nodes share the underlying tree, but
+  ///          changes to a copy and to the original are independent
   /// @param node YAML node to copy
   /// @return pointer to the new YAML node
   Yaml* YamlCopyNode(Yaml* node);
@@ -263,11 +345,12 @@ extern "C"
   /// @param ptr Node pointer to free memory for
   void YamlDeleteNode(Yaml* ptr);
 
-  /// @brief Cleans up memory for a char array
+  /// @brief Cleans up memory for a char array returned by YamlToString
   /// @param string String to free memory for
   void YamlDeleteString(StringT string);
 
   /// @brief Cleans up memory for an array of strings
+  /// @details The individual strings are owned by the YAML node and are not freed
   /// @param array array to free memory for
   void YamlDeleteStringArray(StringArrayT array);
 
@@ -0,0 +1,53 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Runtime selection of instruction-set variants of the C++ kernels
+#pragma once
+
+#include <string>
+
+// Instruction-set variants are built with per-function target attributes,
+// which are available for x86 with GCC and Clang-based compilers
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #define TUVX_HAS_X86_DISPATCH
+#endif
+
+namespace tuvx
+{
+
+  /// @brief Instruction sets the dispatched kernels are compiled for
+  enum class InstructionSet
+  {
+    Baseline,  ///< Instruction set of the build target
+    AVX2,      ///< AVX2 and FMA
+    AVX512     ///< AVX-512 F, DQ, BW, and VL
+  };
+
+  /// @brief Returns the name of an instruction set ("baseline", "avx2", or "avx512")
+  /// @param isa Instruction set
+  const char* InstructionSetName(InstructionSet isa);
+
+  /// @brief Parses the name of an instruction set (case insensitive)
+  /// @param name Name as returned by InstructionSetName()
+  /// @param isa Parsed instruction set
+  /// @return false if the name is not recognized
+  bool ParseInstructionSet(const std::string& name, InstructionSet& isa);
+
+  /// @brief Returns whether kernels were built for an instruction set and the CPU supports it
+  /// @param isa Instruction set
+  bool IsSupported(InstructionSet isa);
+
+  /// @brief Chooses an instruction set for the dispatched kernels
+  /// @param requested Name of the instruction set to use, or nullptr (or an empty string)
+  ///                  to use the most capable supported instruction set. Unrecognized or
+  ///                  unsupported requests are reported and ignored.
+  /// @param log Write the choice to std::clog
+  InstructionSet SelectInstructionSet(const char* requested, const bool& log = false);
+
+  /// @brief Returns the instruction set used by the dispatched kernels
+  ///
+  /// The instruction set is chosen on the first call, from the TUVX_INSTRUCTION_SET
+  /// environment variable if it is set, and the choice is written to std::clog.
+  InstructionSet SelectedInstructionSet();
+
+}  // namespace tuvx
@@ -0,0 +1,43 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Heap allocation accounting (glibc malloc interposition)
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /// @brief Number of counts returned by MemoryAllocationCounts()
+  ///
+  /// The counts are, in order: number of allocations and bytes allocated.
+  enum
+  {
+    kMemoryCountCount = 2
+  };
+
+  /// @brief Reads the allocation counts of the calling thread
+  ///
+  /// Every malloc, calloc, realloc and aligned allocation of the process is
+  /// counted, including those of the Fortran runtime and the C++ standard
+  /// library, by the thread that made it. Bytes are the usable sizes of the
+  /// allocated blocks.
+  /// @param values Counts since the thread started [kMemoryCountCount]
+  void MemoryAllocationCounts(int64_t* values);
+
+  /// @brief Returns the bytes allocated minus the bytes freed by the calling thread
+  ///
+  /// Frees are counted for the thread that frees the memory, whichever thread
+  /// allocated it. The difference between two calls is the heap memory retained
+  /// by the work done in between on the calling thread, as long as that work
+  /// frees no memory allocated on other threads and no other thread frees memory
+  /// it allocated. Otherwise, the differences must be summed over all threads that
+  /// share the memory; memory passed between them then cancels out in the sum.
+  int64_t MemoryLiveBytes();
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,34 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Hardware performance counters for the stage timers (Linux perf_event_open)
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /// @brief Number of counters returned by PerfCountersRead()
+  ///
+  /// The counters are, in order: CPU cycles, retired instructions, last-level
+  /// cache references, and last-level cache misses.
+  enum
+  {
+    kPerfCounterCount = 4
+  };
+
+  /// @brief Reads the performance counters of the calling thread
+  ///
+  /// The counters are opened on the first call from each thread and count
+  /// user-space events of that thread only. Counters that the kernel or the
+  /// hardware does not provide are returned as -1. Values are scaled when the
+  /// kernel multiplexes the counters.
+  /// @param values Current counter values [kPerfCounterCount]
+  void PerfCountersRead(int64_t* values);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,96 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+#include <tuvx/linear_algebra/dispatch.hpp>
+
+// Each variant is a wrapper with a target attribute that inlines the generic
+// kernel (flatten), so the kernel is compiled for the wrapper's instruction
+// set. Anything that is not inlined is compiled for the baseline, so no code
+// for an unsupported instruction set is reached through shared symbols.
+#define TUVX_TRIDIAGONAL_VARIANTS(SUFFIX, ATTRIBUTES)                                                                \
+  ATTRIBUTES void Solve##SUFFIX(TridiagonalMatrix<double> &A, std::vector<double> &b)                               \
+  {                                                                                                                  \
+    tuvx::Solve(A, b);                                                                                               \
+  }                                                                                                                  \
+  ATTRIBUTES void Solve##SUFFIX(TridiagonalMatrix<float> &A, std::vector<float> &b)                                 \
+  {                                                                                                                  \
+    tuvx::Solve(A, b);                                                                                               \
+  }                                                                                                                  \
+  ATTRIBUTES void SolveMixedPrecision##SUFFIX(                                                                       \
+      const TridiagonalMatrix<double> &A, std::vector<double> &b, const std::size_t &refinement_steps)               \
+  {                                                                                                                  \
+    tuvx::SolveMixedPrecision(A, b, refinement_steps);                                                               \
+  }                                                                                                                  \
+  ATTRIBUTES std::vector<double> Dot##SUFFIX(const TridiagonalMatrix<double> &A, const std::vector<double> &x)      \
+  {                                                                                                                  \
+    return tuvx::Dot(A, x);                                                                                          \
+  }                                                                                                                  \
+  ATTRIBUTES std::vector<float> Dot##SUFFIX(const TridiagonalMatrix<float> &A, const std::vector<float> &x)         \
+  {                                                                                                                  \
+    return tuvx::Dot(A, x);                                                                                          \
+  }
+
+namespace tuvx
+{
+  namespace dispatch
+  {
+    namespace
+    {
+#ifdef TUVX_HAS_X86_DISPATCH
+      TUVX_TRIDIAGONAL_VARIANTS(AVX2, __attribute__((target("avx2,fma"), flatten)))
+      TUVX_TRIDIAGONAL_VARIANTS(AVX512, __attribute__((target("avx2,fma,avx512f,avx512dq,avx512bw,avx512vl"), flatten)))
+#endif
+
+      /// @brief Returns the instruction set to run for a request
+      InstructionSet Available(InstructionSet isa)
+      {
+        static const bool has_avx2 = IsSupported(InstructionSet::AVX2);
+        static const bool has_avx512 = IsSupported(InstructionSet::AVX512);
+        if ((isa == InstructionSet::AVX2 && has_avx2) || (isa == InstructionSet::AVX512 && has_avx512))
+          return isa;
+        return InstructionSet::Baseline;
+      }
+    }  // namespace
+
+#ifdef TUVX_HAS_X86_DISPATCH
+  #define TUVX_DISPATCH(ISA, KERNEL, ...)                                                                             \
+    switch (Available(ISA))                                                                                          \
+    {                                                                                                                \
+      case InstructionSet::AVX512: return KERNEL##AVX512(__VA_ARGS__);                                               \
+      case InstructionSet::AVX2: return KERNEL##AVX2(__VA_ARGS__);                                                   \
+      default: return tuvx::KERNEL(__VA_ARGS__);                                                                     \
+    }
+#else
+  #define TUVX_DISPATCH(ISA, KERNEL, ...) return tuvx::KERNEL(__VA_ARGS__);
+#endif
+
+    void Solve(InstructionSet isa, TridiagonalMatrix<double> &A, std::vector<double> &b)
+    {
+      TUVX_DISPATCH(isa, Solve, A, b)
+    }
+
+    void Solve(InstructionSet isa, TridiagonalMatrix<float> &A, std::vector<float> &b)
+    {
+      TUVX_DISPATCH(isa, Solve, A, b)
+    }
+
+    void SolveMixedPrecision(
+        InstructionSet isa,
+        const TridiagonalMatrix<double> &A,
+        std::vector<double> &b,
+        const std::size_t &refinement_steps)
+    {
+      TUVX_DISPATCH(isa, SolveMixedPrecision, A, b, refinement_steps)
+    }
+
+    std::vector<double> Dot(InstructionSet isa, const TridiagonalMatrix<double> &A, const std::vector<double> &x)
+    {
+      TUVX_DISPATCH(isa, Dot, A, x)
+    }
+
+    std::vector<float> Dot(InstructionSet isa, const TridiagonalMatrix<float> &A, const std::vector<float> &x)
+    {
+      TUVX_DISPATCH(isa, Dot, A, x)
+    }
+
+  }  // namespace dispatch
+}  // namespace tuvx
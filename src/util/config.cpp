@@ -4,80 +4,550 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <clocale>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <limits>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+struct YamlDocument
+{
+  /// Mutable clones of the modified subtrees of a compiled document, by the
+  /// tree index of the subtree root. The rest of the document is read from
+  /// the tree.
+  std::map<std::size_t, YAML::Node> overlays_;
+};
+
+namespace
+{
+  using tuvx::ConfigTree;
+
+  /// @brief Creates a handle to a compiled document
+  Yaml* NewTree(const YAML::Node& root)
+  {
+    Yaml* node = new Yaml;
+    node->tree_ = std::make_shared<const ConfigTree>(root);
+    node->document_ = std::make_shared<YamlDocument>();
+    return node;
+  }
+
+  /// @brief Creates a handle to a node of a compiled tree
+  Yaml* NewView(const std::shared_ptr<const ConfigTree>& tree, const std::shared_ptr<YamlDocument>& document, std::size_t index)
+  {
+    Yaml* node = new Yaml;
+    node->tree_ = tree;
+    node->document_ = document;
+    node->index_ = index;
+    return node;
+  }
+
+  /// @brief Creates a handle that holds a mutable YAML node
+  Yaml* NewNode(const YAML::Node& yaml)
+  {
+    Yaml* node = new Yaml;
+    node->node_.reset(yaml);
+    return node;
+  }
+
+  /// @brief Returns true if a tree node is an ancestor of another
+  bool IsAncestor(const ConfigTree& tree, std::size_t ancestor, std::size_t index)
+  {
+    for (std::size_t i = tree.Parent(index); i != ConfigTree::npos; i = tree.Parent(i))
+      if (i == ancestor)
+        return true;
+    return false;
+  }
+
+  /// @brief Returns the node of a clone of the subtree at root that
+  ///        corresponds to a tree node below root
+  YAML::Node Descend(const ConfigTree& tree, const YAML::Node& clone, std::size_t root, std::size_t index)
+  {
+    std::vector<std::size_t> path;
+    for (std::size_t i = index; i != root; i = tree.Parent(i))
+      path.push_back(i);
+    YAML::Node yaml = clone;
+    for (auto step = path.rbegin(); step != path.rend(); ++step)
+    {
+      const std::size_t parent = tree.Parent(*step);
+      YAML::Node child = tree.Type(parent) == ConfigTree::NodeType::Map ? yaml[tree.Key(*step)]
+                                                                          : yaml[*step - tree.FirstChild(parent)];
+      yaml.reset(child);
+    }
+    return yaml;
+  }
+
+  /// @brief Finds the modified subtree that contains a tree node
+  /// @param yaml set to the node of the modified subtree that corresponds to
+  ///             the tree node
+  /// @return true if the node, or one of its ancestors, has been modified
+  bool FindOverlay(const ConfigTree& tree, const YamlDocument& document, std::size_t index, YAML::Node& yaml)
+  {
+    for (std::size_t root = index; root != ConfigTree::npos; root = tree.Parent(root))
+    {
+      auto overlay = document.overlays_.find(root);
+      if (overlay == document.overlays_.end())
+        continue;
+      yaml.reset(Descend(tree, overlay->second, root, index));
+      return true;
+    }
+    return false;
+  }
+
+  /// @brief Returns true if a subtree below a tree node has been modified
+  bool HasModifiedDescendants(const ConfigTree& tree, const YamlDocument& document, std::size_t index)
+  {
+    for (const auto& overlay : document.overlays_)
+      if (IsAncestor(tree, index, overlay.first))
+        return true;
+    return false;
+  }
+
+  /// @brief Returns true if a tree node, or a subtree below it, has been
+  ///        modified
+  bool IsModified(const ConfigTree& tree, const YamlDocument& document, std::size_t index)
+  {
+    const auto& overlays = document.overlays_;
+    return !overlays.empty() && (overlays.count(index) > 0 || HasModifiedDescendants(tree, document, index));
+  }
+
+  /// @brief Clones the subtree at an unmodified tree node so it can be modified
+  /// @details Subtrees below the node that were modified earlier are grafted
+  ///          into the clone, so it reflects every change made so far.
+  /// @return the root of the clone
+  YAML::Node Detach(const ConfigTree& tree, YamlDocument& document, std::size_t index)
+  {
+    YAML::Node clone = YAML::Clone(tree.Source(index));
+    auto& overlays = document.overlays_;
+    for (auto overlay = overlays.begin(); overlay != overlays.end();)
+    {
+      if (!IsAncestor(tree, index, overlay->first))
+      {
+        ++overlay;
+        continue;
+      }
+      const std::size_t parent = tree.Parent(overlay->first);
+      YAML::Node target = Descend(tree, clone, index, parent);
+      if (tree.Type(parent) == ConfigTree::NodeType::Map)
+        target[tree.Key(overlay->first)] = overlay->second;
+      else
+        target[overlay->first - tree.FirstChild(parent)] = overlay->second;
+      overlay = overlays.erase(overlay);
+    }
+    overlays[index] = clone;
+    return clone;
+  }
+
+  /// @brief Switches a view to a mutable YAML node
+  void Switch(Yaml* node, const YAML::Node& yaml)
+  {
+    node->node_.reset(yaml);
+    node->tree_.reset();
+    node->document_.reset();
+    node->index_ = 0;
+  }
+
+  /// @brief Returns true if a handle is a view of an unmodified subtree
+  /// @details Views into a subtree that has been modified through another
+  ///          handle are switched to the corresponding node of the modified
+  ///          subtree
+  bool IsView(Yaml* node)
+  {
+    if (!node->tree_)
+      return false;
+    if (node->document_->overlays_.empty())
+      return true;
+    YAML::Node yaml;
+    if (!FindOverlay(*node->tree_, *node->document_, node->index_, yaml))
+      return true;
+    Switch(node, yaml);
+    return false;
+  }
+
+  /// @brief Returns the YAML node a handle refers to, including changes made
+  ///        to subtrees below it
+  YAML::Node AsYaml(const Yaml* node)
+  {
+    if (!node->tree_)
+      return node->node_;
+    const ConfigTree& tree = *node->tree_;
+    YAML::Node yaml;
+    if (FindOverlay(tree, *node->document_, node->index_, yaml))
+      return yaml;
+    if (HasModifiedDescendants(tree, *node->document_, node->index_))
+      return Detach(tree, *node->document_, node->index_);
+    return tree.Source(node->index_);
+  }
+
+  /// @brief Returns an independent copy of the YAML node a handle refers to
+  YAML::Node CloneYaml(const Yaml* node)
+  {
+    return YAML::Clone(AsYaml(node));
+  }
+
+  /// @brief Converts a handle to a compiled node into a mutable YAML node
+  /// @details Only the subtree the handle refers to is cloned, the first
+  ///          time it is modified
+  void MakeMutable(Yaml* node)
+  {
+    if (IsView(node))
+      Switch(node, Detach(*node->tree_, *node->document_, node->index_));
+  }
+
+  /// @brief Finds a child node by key
+  /// @details Children of compiled documents are returned from the tree
+  ///          without creating a YAML node, unless the child was modified
+  ///          through another handle. For mutable nodes the child is looked
+  ///          up with yaml-cpp and held in scratch.
+  /// @return the child node, or nullptr if not found
+  const YAML::Node* Child(Yaml* node, const char* key, YAML::Node& scratch)
+  {
+    if (IsView(node))
+    {
+      const ConfigTree& tree = *node->tree_;
+      std::size_t child = tree.Find(node->index_, key);
+      if (child == ConfigTree::npos)
+        return nullptr;
+      if (!IsModified(tree, *node->document_, child))
+        return &tree.Source(child);
+      auto& overlays = node->document_->overlays_;
+      auto overlay = overlays.find(child);
+      if (overlay != overlays.end())
+        return &overlay->second;
+      scratch.reset(Detach(tree, *node->document_, child));
+      return &scratch;
+    }
+    const YAML::Node& yaml = node->node_;
+    const YAML::Node child = yaml[key];
+    if (!child.IsDefined())
+      return nullptr;
+    scratch.reset(child);
+    return &scratch;
+  }
+
+  /// @brief Returns a view of a scalar node's string value
+  StringT StringView(const YAML::Node& node)
+  {
+    static const std::string null_string = "null";
+    const std::string& str = node.IsNull() ? null_string : node.Scalar();
+    if (!node.IsNull() && !node.IsScalar())
+      node.as<std::string>();  // throws the standard conversion error
+    StringT string;
+    string.ptr_ = const_cast<char*>(str.c_str());
+    string.size_ = str.length();
+    return string;
+  }
+
+  /// @brief Returns true if the current locale uses '.' as the decimal mark
+  /// @details yaml-cpp converts numbers in the classic "C" locale, while
+  ///          strtod uses the current one
+  bool DecimalMarkIsPoint()
+  {
+    const char* mark = std::localeconv()->decimal_point;
+    return mark[0] == '.' && mark[1] == '\0';
+  }
+
+  /// @brief Parses a plain number from a scalar node in place
+  /// @details Only strings made up of the given characters are parsed, and
+  ///          only when the current locale agrees with yaml-cpp on the
+  ///          decimal mark. False is returned for anything else, including
+  ///          values that are out of range, so that the caller can fall back
+  ///          on the yaml-cpp conversion.
+  template<typename T, typename F>
+  bool ParsePlainNumber(const YAML::Node& node, const char* characters, F parse, T& value)
+  {
+    if (!node.IsScalar() || !DecimalMarkIsPoint())
+      return false;
+    const std::string& str = node.Scalar();
+    if (str.empty() || str.find_first_not_of(characters) != std::string::npos)
+      return false;
+    const int saved_errno = errno;
+    errno = 0;
+    char* end = nullptr;
+    value = parse(str.c_str(), &end);
+    const bool in_range = errno != ERANGE;
+    errno = saved_errno;
+    return in_range && end == str.c_str() + str.length();
+  }
+
+  /// @brief Converts a scalar node to a double
+  /// @details Plain decimal numbers are parsed in place; anything else goes
+  ///          through the yaml-cpp conversion so special values and errors
+  ///          are handled as before
+  double ToDouble(const YAML::Node& node)
+  {
+    double value = 0.0;
+    if (ParsePlainNumber(node, "0123456789+-.eE", [](const char* s, char** end) { return std::strtod(s, end); }, value))
+      return value;
+    return node.as<double>();
+  }
+
+  /// @brief Converts a scalar node to a float
+  /// @details See ToDouble
+  float ToFloat(const YAML::Node& node)
+  {
+    float value = 0.0f;
+    if (ParsePlainNumber(node, "0123456789+-.eE", [](const char* s, char** end) { return std::strtof(s, end); }, value))
+      return value;
+    return node.as<float>();
+  }
+
+  /// @brief Converts a scalar node to an int
+  /// @details Plain decimal integers are parsed in place. yaml-cpp reads
+  ///          integers with a leading zero as octal, so these and anything
+  ///          else go through the yaml-cpp conversion.
+  int ToInt(const YAML::Node& node)
+  {
+    long value = 0;
+    if (node.IsScalar())
+    {
+      const std::string& str = node.Scalar();
+      const std::size_t first_digit = (!str.empty() && (str[0] == '+' || str[0] == '-')) ? 1 : 0;
+      const bool octal = str.length() > first_digit + 1 && str[first_digit] == '0';
+      auto parse = [](const char* s, char** end) { return std::strtol(s, end, 10); };
+      if (!octal && ParsePlainNumber(node, "0123456789+-", parse, value) && value >= std::numeric_limits<int>::min() &&
+          value <= std::numeric_limits<int>::max())
+        return static_cast<int>(value);
+    }
+    return node.as<int>();
+  }
+
+  /// @brief Calls a function for each of the first size elements of an array
+  ///        found with Child
+  template<typename F>
+  void ForEachChild(Yaml* node, const char* key, int size, F f)
+  {
+    YAML::Node scratch;
+    const YAML::Node* array_node = Child(node, key, scratch);
+    if (!array_node)
+      return;
+    std::size_t i = 0;
+    for (YAML::const_iterator it = array_node->begin(); it != array_node->end() && i < static_cast<std::size_t>(size); ++it)
+      f(i++, *it);
+  }
+
+  /// @brief Calls a function for each of the first size elements of an array
+  /// @details Unmodified arrays of compiled documents are read from the tree.
+  ///          Arrays modified through another handle are read through Child.
+  template<typename F>
+  void ForEachElement(Yaml* node, const char* key, int size, F f)
+  {
+    if (IsView(node))
+    {
+      const ConfigTree& tree = *node->tree_;
+      std::size_t array = tree.Find(node->index_, key);
+      if (array == ConfigTree::npos)
+        return;
+      if (IsModified(tree, *node->document_, array))
+        return ForEachChild(node, key, size, f);
+      std::size_t first = tree.FirstChild(array);
+      std::size_t n = std::min(tree.NumberOfChildren(array), static_cast<std::size_t>(size));
+      for (std::size_t i = 0; i < n; ++i)
+        f(i, tree.Source(first + i));
+      return;
+    }
+    ForEachChild(node, key, size, f);
+  }
+
+  /// @brief Returns an array of views of the string values in a sequence node
+  StringArrayT StringArrayView(const YAML::Node& array_node)
+  {
+    StringArrayT array;
+    array.size_ = array_node.size();
+    array.ptr_ = new StringT[array.size_];
+    std::size_t i = 0;
+    for (YAML::const_iterator it = array_node.begin(); it != array_node.end(); ++it)
+      array.ptr_[i++] = StringView(*it);
+    return array;
+  }
+
+  /// @brief Returns the YAML node for the current element of an iterator
+  YAML::Node IteratorValue(const YamlIterator* iter)
+  {
+    if (iter->tree_)
+    {
+      YAML::Node yaml;
+      if (FindOverlay(*iter->tree_, *iter->document_, iter->index_, yaml))
+        return yaml;
+      return iter->tree_->Source(iter->index_);
+    }
+    return iter->iter_->IsDefined() ? iter->iter_->as<YAML::Node>() : iter->iter_->second;
+  }
+
+  /// @brief Merges one YAML node into another
+  bool MergeNode(YAML::Node& node, const YAML::Node& other)
+  {
+    if (!node.IsMap() || !other.IsMap())
+      return false;
+    for (YAML::const_iterator it = other.begin(); it != other.end(); ++it)
+    {
+      std::string key = it->first.as<std::string>();
+      if (node[key].IsDefined() && node[key].IsMap() && it->second.IsMap())
+      {
+        YAML::Node subnode = node[key];
+        if (!MergeNode(subnode, it->second))
+          return false;
+        node[key] = subnode;
+      }
+      else
+      {
+        if (node[key].IsDefined() && !node[key].is(it->second))
+        {
+          return false;
+        }
+        node[key] = it->second;
+      }
+    }
+    return true;
+  }
+}  // namespace
 
 Yaml* YamlCreateFromString(const char* yaml_string)
 {
-  return new YAML::Node(YAML::Load(yaml_string));
+  return NewTree(YAML::Load(yaml_string));
 }
 
 Yaml* YamlCreateFromFile(const char* file_path)
 {
-  return new YAML::Node(YAML::LoadFile(file_path));
+  return NewTree(YAML::LoadFile(file_path));
 }
 
 void YamlToFile(Yaml* node, const char* file_path)
 {
   std::ofstream file(file_path, std::ofstream::trunc);
-  file << *node;
+  file << AsYaml(node);
   file.close();
 }
 
 int YamlSize(Yaml* node)
 {
-  return node->size();
+  if (IsView(node))
+    return node->tree_->NumberOfChildren(node->index_);
+  return node->node_.size();
+}
+
+int YamlCountKey(Yaml* node, const char* key)
+{
+  if (IsView(node))
+    return static_cast<int>(node->tree_->Count(node->index_, key));
+  if (!node->node_.IsMap())
+    return 0;
+  int count = 0;
+  for (YAML::const_iterator it = node->node_.begin(); it != node->node_.end(); ++it)
+    count += it->first.Scalar() == key ? 1 : 0;
+  return count;
+}
+
+int YamlCountKeys(Yaml* node, const char* ignore_prefix)
+{
+  const std::size_t prefix_length = std::strlen(ignore_prefix);
+  auto counted = [&](const std::string& key) { return prefix_length == 0 || key.compare(0, prefix_length, ignore_prefix) != 0; };
+  int count = 0;
+  if (IsView(node))
+  {
+    const ConfigTree& tree = *node->tree_;
+    if (tree.Type(node->index_) != ConfigTree::NodeType::Map)
+      return 0;
+    std::size_t first = tree.FirstChild(node->index_);
+    std::size_t end = first + tree.NumberOfChildren(node->index_);
+    for (std::size_t child = first; child < end; ++child)
+      count += counted(tree.Key(child)) ? 1 : 0;
+    return count;
+  }
+  if (!node->node_.IsMap())
+    return 0;
+  for (YAML::const_iterator it = node->node_.begin(); it != node->node_.end(); ++it)
+    count += counted(it->first.as<std::string>()) ? 1 : 0;
+  return count;
 }
 
 YamlIterator* YamlBegin(Yaml* node)
 {
-  return new YAML::iterator(node->begin());
+  YamlIterator* iter = new YamlIterator;
+  if (IsView(node))
+  {
+    iter->tree_ = node->tree_;
+    iter->document_ = node->document_;
+    iter->index_ = node->tree_->FirstChild(node->index_);
+  }
+  else
+  {
+    iter->iter_ = node->node_.begin();
+  }
+  return iter;
 }
 
 YamlIterator* YamlEnd(Yaml* node)
 {
-  return new YAML::iterator(node->end());
+  YamlIterator* iter = new YamlIterator;
+  if (IsView(node))
+  {
+    iter->tree_ = node->tree_;
+    iter->document_ = node->document_;
+    iter->index_ = node->tree_->FirstChild(node->index_) + node->tree_->NumberOfChildren(node->index_);
+  }
+  else
+  {
+    iter->iter_ = node->node_.end();
+  }
+  return iter;
 }
 
 bool YamlAtEnd(YamlIterator* iter, YamlIterator* end)
 {
-  return *iter == *end;
+  if (iter->tree_)
+    return iter->index_ == end->index_;
+  return iter->iter_ == end->iter_;
 }
 
 bool YamlIncrement(YamlIterator* iter, YamlIterator* end)
 {
-  return ++(*iter) != *end;
+  if (iter->tree_)
+    return ++(iter->index_) != end->index_;
+  return ++(iter->iter_) != end->iter_;
 }
 
 StringT YamlKey(YamlIterator* iter)
 {
-  StringT string;
-  std::string str = (*iter)->first.as<std::string>();
-  string.size_ = str.length();
-  string.ptr_ = new char[string.size_ + 1];
-  strcpy(string.ptr_, str.c_str());
-  return string;
+  if (iter->tree_)
+  {
+    const std::string& key = iter->tree_->Key(iter->index_);
+    StringT string;
+    string.ptr_ = const_cast<char*>(key.c_str());
+    string.size_ = key.length();
+    return string;
+  }
+  return StringView(iter->iter_->first);
 }
 
 Yaml* YamlGetNode(Yaml* node, const char* key, bool& found)
 {
-  YAML::Node subnode = (*node)[key];
+  if (IsView(node))
+  {
+    std::size_t child = node->tree_->Find(node->index_, key);
+    found = child != ConfigTree::npos && node->tree_->Type(child) != ConfigTree::NodeType::Scalar;
+    if (child == ConfigTree::npos)
+      return NewNode(YAML::Node(YAML::NodeType::Undefined));
+    return NewView(node->tree_, node->document_, child);
+  }
+  YAML::Node subnode = node->node_[key];
   found = subnode.IsDefined() && !subnode.IsScalar();
-  return new YAML::Node(subnode);
+  return NewNode(subnode);
 }
 
 StringT YamlGetString(Yaml* node, const char* key, bool& found)
 {
-  found = (*node)[key].IsDefined();
-  StringT string;
+  YAML::Node scratch;
+  const YAML::Node* value = Child(node, key, scratch);
+  found = value != nullptr;
   if (found)
-  {
-    std::string str = (*node)[key].as<std::string>();
-    string.size_ = str.length();
-    string.ptr_ = new char[string.size_ + 1];
-    strcpy(string.ptr_, str.c_str());
-    return string;
-  }
+    return StringView(*value);
+  StringT string;
   string.ptr_ = nullptr;
   string.size_ = 0;
   return string;
@@ -85,33 +555,41 @@ StringT YamlGetString(Yaml* node, const char* key, bool& found)
 
 int YamlGetInt(Yaml* node, const char* key, bool& found)
 {
-  found = (*node)[key].IsDefined();
+  YAML::Node scratch;
+  const YAML::Node* value = Child(node, key, scratch);
+  found = value != nullptr;
   if (found)
-    return (*node)[key].as<int>();
+    return ToInt(*value);
   return 0;
 }
 
 float YamlGetFloat(Yaml* node, const char* key, bool& found)
 {
-  found = (*node)[key].IsDefined();
+  YAML::Node scratch;
+  const YAML::Node* value = Child(node, key, scratch);
+  found = value != nullptr;
   if (found)
-    return (*node)[key].as<float>();
+    return ToFloat(*value);
   return 0.0f;
 }
 
 double YamlGetDouble(Yaml* node, const char* key, bool& found)
 {
-  found = (*node)[key].IsDefined();
+  YAML::Node scratch;
+  const YAML::Node* value = Child(node, key, scratch);
+  found = value != nullptr;
   if (found)
-    return (*node)[key].as<double>();
+    return ToDouble(*value);
   return 0.0;
 }
 
 bool YamlGetBool(Yaml* node, const char* key, bool& found)
 {
-  found = (*node)[key].IsDefined();
+  YAML::Node scratch;
+  const YAML::Node* value = Child(node, key, scratch);
+  found = value != nullptr;
   if (found)
-    return (*node)[key].as<bool>();
+    return value->as<bool>();
   return false;
 }
 
@@ -120,20 +598,12 @@ StringArrayT YamlGetStringArray(Yaml* node, const char* key, bool& found)
   StringArrayT array;
   array.size_ = 0;
   array.ptr_ = nullptr;
-  YAML::Node array_node = (*node)[key];
-  found = array_node.IsDefined();
+  YAML::Node scratch;
+  const YAML::Node* array_node = Child(node, key, scratch);
+  found = array_node != nullptr;
   if (!found)
     return array;
-  array.size_ = array_node.size();
-  array.ptr_ = new StringT[array.size_];
-  for (std::size_t i = 0; i < array_node.size(); ++i)
-  {
-    std::string str = array_node[i].as<std::string>();
-    array.ptr_[i].size_ = str.length();
-    array.ptr_[i].ptr_ = new char[str.length() + 1];
-    strcpy(array.ptr_[i].ptr_, str.c_str());
-  }
-  return array;
+  return StringArrayView(*array_node);
 }
 
 DoubleArrayT YamlGetDoubleArray(Yaml* node, const char* key, bool& found)
@@ -141,158 +611,206 @@ DoubleArrayT YamlGetDoubleArray(Yaml* node, const char* key, bool& found)
   DoubleArrayT array;
   array.size_ = 0;
   array.ptr_ = nullptr;
-  YAML::Node array_node = (*node)[key];
-  found = array_node.IsDefined();
+  YAML::Node scratch;
+  const YAML::Node* array_node = Child(node, key, scratch);
+  found = array_node != nullptr;
   if (!found)
     return array;
-  array.size_ = array_node.size();
+  array.size_ = array_node->size();
   array.ptr_ = new double[array.size_];
-  for (std::size_t i = 0; i < array_node.size(); ++i)
+  std::size_t i = 0;
+  for (YAML::const_iterator it = array_node->begin(); it != array_node->end(); ++it)
   {
-    array.ptr_[i] = array_node[i].as<double>();
+    array.ptr_[i++] = ToDouble(*it);
   }
   return array;
 }
 
+int YamlGetArraySize(Yaml* node, const char* key, bool& found)
+{
+  if (IsView(node))
+  {
+    std::size_t array = node->tree_->Find(node->index_, key);
+    found = array != ConfigTree::npos;
+    if (!found)
+      return 0;
+    if (node->document_->overlays_.count(array) == 0)
+      return static_cast<int>(node->tree_->NumberOfChildren(array));
+  }
+  YAML::Node scratch;
+  const YAML::Node* array_node = Child(node, key, scratch);
+  found = array_node != nullptr;
+  return found ? static_cast<int>(array_node->size()) : 0;
+}
+
+void YamlFillDoubleArray(Yaml* node, const char* key, double* buffer, int size)
+{
+  ForEachElement(node, key, size, [buffer](std::size_t i, const YAML::Node& value) { buffer[i] = ToDouble(value); });
+}
+
+void YamlFillStringArray(Yaml* node, const char* key, StringT* buffer, int size)
+{
+  ForEachElement(node, key, size, [buffer](std::size_t i, const YAML::Node& value) { buffer[i] = StringView(value); });
+}
+
 NodeArrayT YamlGetNodeArray(Yaml* node, const char* key, bool& found)
 {
   NodeArrayT array;
   array.size_ = 0;
   array.ptr_ = nullptr;
-  YAML::Node array_node = (*node)[key];
-  found = array_node.IsDefined();
+  if (IsView(node))
+  {
+    std::size_t child = node->tree_->Find(node->index_, key);
+    found = child != ConfigTree::npos;
+    if (!found)
+      return array;
+    // views of the elements include changes made to them, but not changes
+    // made to the array itself
+    if (node->tree_->Type(child) == ConfigTree::NodeType::Sequence && node->document_->overlays_.count(child) == 0)
+    {
+      std::size_t first = node->tree_->FirstChild(child);
+      std::size_t size = node->tree_->NumberOfChildren(child);
+      array.size_ = static_cast<int>(size);
+      array.ptr_ = new Yaml*[size];
+      for (std::size_t i = 0; i < size; ++i)
+      {
+        array.ptr_[i] = NewView(node->tree_, node->document_, first + i);
+      }
+      return array;
+    }
+  }
+  YAML::Node scratch;
+  const YAML::Node* array_node = Child(node, key, scratch);
+  found = array_node != nullptr;
   if (!found)
     return array;
-  array.size_ = array_node.size();
-  array.ptr_ = new YAML::Node*[array.size_];
-  for (std::size_t i = 0; i < array_node.size(); ++i)
+  array.size_ = array_node->size();
+  array.ptr_ = new Yaml*[array.size_];
+  for (std::size_t i = 0; i < array_node->size(); ++i)
   {
-    array.ptr_[i] = new YAML::Node(array_node[i].as<YAML::Node>());
+    array.ptr_[i] = NewNode((*array_node)[i].as<YAML::Node>());
   }
   return array;
 }
 
 Yaml* YamlGetNodeFromIterator(YamlIterator* iter)
 {
-  return (*iter)->IsDefined() ? new YAML::Node((*iter)->as<YAML::Node>()) : new YAML::Node((*iter)->second.as<YAML::Node>());
+  if (iter->tree_)
+    return NewView(iter->tree_, iter->document_, iter->index_);
+  return NewNode(IteratorValue(iter));
 }
 
 StringT YamlGetStringFromIterator(YamlIterator* iter)
 {
-  StringT string;
-  std::string str = (*iter)->IsDefined() ? (*iter)->as<std::string>() : (*iter)->second.as<std::string>();
-  string.size_ = str.length();
-  string.ptr_ = new char[string.size_ + 1];
-  strcpy(string.ptr_, str.c_str());
-  return string;
+  return StringView(IteratorValue(iter));
 }
 
 int YamlGetIntFromIterator(YamlIterator* iter)
 {
-  return (*iter)->IsDefined() ? (*iter)->as<int>() : (*iter)->second.as<int>();
+  return ToInt(IteratorValue(iter));
 }
 
 float YamlGetFloatFromIterator(YamlIterator* iter)
 {
-  return (*iter)->IsDefined() ? (*iter)->as<float>() : (*iter)->second.as<float>();
+  return ToFloat(IteratorValue(iter));
 }
 
 double YamlGetDoubleFromIterator(YamlIterator* iter)
 {
-  return (*iter)->IsDefined() ? (*iter)->as<double>() : (*iter)->second.as<double>();
+  return ToDouble(IteratorValue(iter));
 }
 
 bool YamlGetBoolFromIterator(YamlIterator* iter)
 {
-  return (*iter)->IsDefined() ? (*iter)->as<bool>() : (*iter)->second.as<bool>();
+  return IteratorValue(iter).as<bool>();
 }
 
 StringArrayT YamlGetStringArrayFromIterator(YamlIterator* iter)
 {
-  StringArrayT array;
-  YAML::Node array_node = (*iter)->IsDefined() ? (*iter)->as<YAML::Node>() : (*iter)->second.as<YAML::Node>();
-  array.size_ = array_node.size();
-  array.ptr_ = new StringT[array.size_];
-  for (std::size_t i = 0; i < array_node.size(); ++i)
-  {
-    std::string str = array_node[i].as<std::string>();
-    array.ptr_[i].size_ = str.length();
-    array.ptr_[i].ptr_ = new char[str.length() + 1];
-    strcpy(array.ptr_[i].ptr_, str.c_str());
-  }
-  return array;
+  return StringArrayView(IteratorValue(iter));
 }
 
 void YamlAddNode(Yaml* node, const char* key, Yaml* value)
 {
-  (*node)[key] = YAML::Clone(*value);
+  MakeMutable(node);
+  node->node_[key] = CloneYaml(value);
 }
 
 void YamlAddString(Yaml* node, const char* key, const char* value)
 {
-  (*node)[key] = value;
+  MakeMutable(node);
+  node->node_[key] = value;
 }
 
 void YamlAddInt(Yaml* node, const char* key, int value)
 {
-  (*node)[key] = value;
+  MakeMutable(node);
+  node->node_[key] = value;
 }
 
 void YamlAddFloat(Yaml* node, const char* key, float value)
 {
-  (*node)[key] = value;
+  MakeMutable(node);
+  node->node_[key] = value;
 }
 
 void YamlAddDouble(Yaml* node, const char* key, double value)
 {
-  (*node)[key] = value;
+  MakeMutable(node);
+  node->node_[key] = value;
 }
 
 void YamlAddBool(Yaml* node, const char* key, bool value)
 {
-  (*node)[key] = value;
+  MakeMutable(node);
+  node->node_[key] = value;
 }
 
 void YamlAddStringArray(Yaml* node, const char* key, StringArrayT value)
 {
+  MakeMutable(node);
   YAML::Node array;
   for (std::size_t i = 0; i < value.size_; ++i)
   {
     array.push_back(value.ptr_[i].ptr_);
   }
-  (*node)[key] = array;
+  node->node_[key] = array;
 }
 
 void YamlAddDoubleArray(Yaml* node, const char* key, DoubleArrayT value)
 {
+  MakeMutable(node);
   YAML::Node array;
   for (std::size_t i = 0; i < value.size_; ++i)
   {
     array.push_back(value.ptr_[i]);
   }
-  (*node)[key] = array;
+  node->node_[key] = array;
 }
 
 void YamlAddNodeArray(Yaml* node, const char* key, NodeArrayT value)
 {
+  MakeMutable(node);
   YAML::Node array;
   for (std::size_t i = 0; i < value.size_; ++i)
   {
-    array.push_back(*(value.ptr_[i]));
+    array.push_back(CloneYaml(value.ptr_[i]));
   }
-  (*node)[key] = array;
+  node->node_[key] = array;
 }
 
 Yaml* YamlCopyNode(Yaml* node)
 {
-  return new YAML::Node(YAML::Clone(*node));
+  if (IsView(node) && !HasModifiedDescendants(*node->tree_, *node->document_, node->index_))
+    return NewView(node->tree_, std::make_shared<YamlDocument>(), node->index_);
+  return NewNode(CloneYaml(node));
 }
 
 StringT YamlToString(Yaml* node)
 {
   StringT string;
   YAML::Emitter out;
-  out << *node;
+  out << AsYaml(node);
   string.size_ = out.size();
   string.ptr_ = new char[string.size_ + 1];
   strcpy(string.ptr_, out.c_str());
@@ -301,28 +819,8 @@ StringT YamlToString(Yaml* node)
 
 bool YamlMergeNode(Yaml* node, const Yaml* other)
 {
-  if (!node->IsMap() || !other->IsMap())
-    return false;
-  for (YAML::const_iterator it = (*other).begin(); it != (*other).end(); ++it)
-  {
-    std::string key = it->first.as<std::string>();
-    if ((*node)[key].IsDefined() && (*node)[key].IsMap() && it->second.IsMap())
-    {
-      Yaml subnode = (*node)[key];
-      if (!YamlMergeNode(&subnode, &it->second))
-        return false;
-      (*node)[key] = subnode;
-    }
-    else
-    {
-      if ((*node)[key].IsDefined() && !(*node)[key].is(it->second))
-      {
-        return false;
-      }
-      (*node)[key] = it->second;
-    }
-  }
-  return true;
+  MakeMutable(node);
+  return MergeNode(node->node_, other->tree_ ? CloneYaml(other) : other->node_);
 }
 
 void YamlDeleteNode(Yaml* ptr)
@@ -337,12 +835,6 @@ void YamlDeleteString(StringT string)
 
 void YamlDeleteStringArray(StringArrayT array)
 {
-  if (!array.ptr_)
-    return;
-  for (std::size_t i = 0; i < array.size_; ++i)
-  {
-    delete[] array.ptr_[i].ptr_;
-  }
   delete[] array.ptr_;
 }
 
@@ -359,4 +851,4 @@ void YamlDeleteNodeArray(NodeArrayT array)
 void YamlDeleteIterator(YamlIterator* ptr)
 {
   delete ptr;
-}
\ No newline at end of file
+}
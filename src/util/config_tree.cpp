@@ -0,0 +1,131 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+#include <tuvx/util/config_tree.hpp>
+
+#include <cstring>
+
+namespace tuvx
+{
+
+  constexpr std::size_t ConfigTree::npos;
+
+  ConfigTree::ConfigTree(const YAML::Node& root)
+  {
+    std::unordered_map<std::string, std::size_t> key_ids;
+    keys_.push_back("");
+    nodes_.push_back({ NodeType::Null, npos, 0, 0, 0 });
+    sources_.push_back(root);
+    Compile(0, key_ids);
+    BuildIndex();
+  }
+
+  std::size_t ConfigTree::Find(std::size_t node, const char* key) const
+  {
+    if (nodes_[node].type_ != NodeType::Map || slots_.empty())
+      return npos;
+    const std::size_t mask = slots_.size() - 1;
+    for (std::size_t slot = Hash(node, key) & mask;; slot = (slot + 1) & mask)
+    {
+      const std::size_t child = slots_[slot];
+      if (child == npos)
+        return npos;
+      if (nodes_[child].parent_ == node && keys_[nodes_[child].key_] == key)
+        return child;
+    }
+  }
+
+  std::size_t ConfigTree::Count(std::size_t node, const char* key) const
+  {
+    const std::size_t first = Find(node, key);
+    if (first == npos)
+      return 0;
+    // Find returns the first entry with the key, so duplicates follow it
+    const std::size_t end = nodes_[node].first_child_ + nodes_[node].number_of_children_;
+    std::size_t count = 0;
+    for (std::size_t child = first; child < end; ++child)
+      count += nodes_[child].key_ == nodes_[first].key_ ? 1 : 0;
+    return count;
+  }
+
+  void ConfigTree::Compile(std::size_t node, std::unordered_map<std::string, std::size_t>& key_ids)
+  {
+    // copy the handle, as sources_ may be reallocated below
+    const YAML::Node source = sources_[node];
+    switch (source.Type())
+    {
+      case YAML::NodeType::Scalar: nodes_[node].type_ = NodeType::Scalar; return;
+      case YAML::NodeType::Sequence: nodes_[node].type_ = NodeType::Sequence; break;
+      case YAML::NodeType::Map: nodes_[node].type_ = NodeType::Map; break;
+      default: nodes_[node].type_ = NodeType::Null; return;
+    }
+    const std::size_t first = nodes_.size();
+    const bool is_map = nodes_[node].type_ == NodeType::Map;
+    nodes_[node].first_child_ = first;
+    for (YAML::const_iterator it = source.begin(); it != source.end(); ++it)
+    {
+      std::size_t key = 0;
+      if (is_map)
+      {
+        auto inserted = key_ids.insert(std::make_pair(it->first.as<std::string>(), keys_.size()));
+        if (inserted.second)
+          keys_.push_back(inserted.first->first);
+        key = inserted.first->second;
+        sources_.push_back(it->second);
+      }
+      else
+      {
+        sources_.push_back(*it);
+      }
+      nodes_.push_back({ NodeType::Null, node, key, 0, 0 });
+    }
+    const std::size_t end = nodes_.size();
+    nodes_[node].number_of_children_ = end - first;
+    for (std::size_t child = first; child < end; ++child)
+      Compile(child, key_ids);
+  }
+
+  void ConfigTree::BuildIndex()
+  {
+    std::size_t n_entries = 0;
+    for (const auto& node : nodes_)
+      if (node.type_ == NodeType::Map)
+        n_entries += node.number_of_children_;
+    if (n_entries == 0)
+      return;
+    std::size_t n_slots = 8;
+    while (n_slots < 2 * n_entries)
+      n_slots *= 2;
+    slots_.assign(n_slots, npos);
+    const std::size_t mask = n_slots - 1;
+    for (std::size_t node = 0; node < nodes_.size(); ++node)
+    {
+      if (nodes_[node].type_ != NodeType::Map)
+        continue;
+      const std::size_t end = nodes_[node].first_child_ + nodes_[node].number_of_children_;
+      for (std::size_t child = nodes_[node].first_child_; child < end; ++child)
+      {
+        // duplicate keys resolve to the first entry, as in yaml-cpp
+        if (Find(node, keys_[nodes_[child].key_].c_str()) != npos)
+          continue;
+        std::size_t slot = Hash(node, keys_[nodes_[child].key_].c_str()) & mask;
+        while (slots_[slot] != npos)
+          slot = (slot + 1) & mask;
+        slots_[slot] = child;
+      }
+    }
+  }
+
+  std::uint64_t ConfigTree::Hash(std::size_t parent, const char* key)
+  {
+    // FNV-1a over the key, combined with the parent index
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (; *key != '\0'; ++key)
+    {
+      hash ^= static_cast<unsigned char>(*key);
+      hash *= 1099511628211ULL;
+    }
+    hash ^= static_cast<std::uint64_t>(parent) * 0x9E3779B97F4A7C15ULL;
+    return hash ^ (hash >> 32);
+  }
+
+}  // namespace tuvx
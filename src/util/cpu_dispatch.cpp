@@ -0,0 +1,93 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+#include <tuvx/util/cpu_dispatch.hpp>
+
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+
+namespace tuvx
+{
+
+  const char* InstructionSetName(InstructionSet isa)
+  {
+    switch (isa)
+    {
+      case InstructionSet::AVX2: return "avx2";
+      case InstructionSet::AVX512: return "avx512";
+      default: return "baseline";
+    }
+  }
+
+  bool ParseInstructionSet(const std::string& name, InstructionSet& isa)
+  {
+    std::string lower(name);
+    for (auto& c : lower)
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    for (const auto candidate : { InstructionSet::Baseline, InstructionSet::AVX2, InstructionSet::AVX512 })
+    {
+      if (lower == InstructionSetName(candidate))
+      {
+        isa = candidate;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool IsSupported(InstructionSet isa)
+  {
+    switch (isa)
+    {
+      case InstructionSet::Baseline: return true;
+#ifdef TUVX_HAS_X86_DISPATCH
+      case InstructionSet::AVX2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+      case InstructionSet::AVX512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+               __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl");
+#endif
+      default: return false;
+    }
+  }
+
+  InstructionSet SelectInstructionSet(const char* requested, const bool& log)
+  {
+    InstructionSet isa = InstructionSet::Baseline;
+    for (const auto candidate : { InstructionSet::AVX2, InstructionSet::AVX512 })
+      if (IsSupported(candidate))
+        isa = candidate;
+    if (requested == nullptr || *requested == '\0')
+    {
+      if (log)
+        std::clog << "TUV-x: using " << InstructionSetName(isa) << " kernels" << std::endl;
+      return isa;
+    }
+    InstructionSet forced;
+    if (!ParseInstructionSet(requested, forced))
+    {
+      std::clog << "TUV-x: ignoring unknown instruction set '" << requested << "'" << std::endl;
+    }
+    else if (!IsSupported(forced))
+    {
+      std::clog << "TUV-x: ignoring unsupported instruction set '" << requested << "'" << std::endl;
+    }
+    else
+    {
+      isa = forced;
+    }
+    if (log)
+      std::clog << "TUV-x: using " << InstructionSetName(isa) << " kernels (requested '" << requested << "')"
+                << std::endl;
+    return isa;
+  }
+
+  InstructionSet SelectedInstructionSet()
+  {
+    static const InstructionSet selected = SelectInstructionSet(std::getenv("TUVX_INSTRUCTION_SET"), true);
+    return selected;
+  }
+
+}  // namespace tuvx
@@ -0,0 +1,105 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// The heap functions of the C library are replaced by wrappers that count each
+// allocation for the calling thread and then call the glibc implementations.
+// Because the wrappers are defined in the executable (or in a library loaded
+// before the C library), they also see allocations made by the Fortran runtime
+// and the C++ standard library.
+#include <tuvx/util/memory_accounting.h>
+
+#include <malloc.h>
+
+#include <cerrno>
+#include <cstddef>
+
+extern "C"
+{
+  void* __libc_malloc(std::size_t size);
+  void* __libc_calloc(std::size_t count, std::size_t size);
+  void* __libc_realloc(void* ptr, std::size_t size);
+  void* __libc_memalign(std::size_t alignment, std::size_t size);
+  void __libc_free(void* ptr);
+}
+
+namespace
+{
+  // Initial-exec thread-local storage is never allocated lazily, so the
+  // counters can be updated from inside the allocator.
+  __thread int64_t allocations __attribute__((tls_model("initial-exec"))) = 0;
+  __thread int64_t bytes_allocated __attribute__((tls_model("initial-exec"))) = 0;
+  __thread int64_t bytes_freed __attribute__((tls_model("initial-exec"))) = 0;
+
+  inline void* Allocated(void* ptr)
+  {
+    if (ptr)
+    {
+      ++allocations;
+      bytes_allocated += static_cast<int64_t>(malloc_usable_size(ptr));
+    }
+    return ptr;
+  }
+
+  inline void Freeing(void* ptr)
+  {
+    if (ptr)
+      bytes_freed += static_cast<int64_t>(malloc_usable_size(ptr));
+  }
+}  // namespace
+
+void MemoryAllocationCounts(int64_t* values)
+{
+  values[0] = allocations;
+  values[1] = bytes_allocated;
+}
+
+int64_t MemoryLiveBytes()
+{
+  return bytes_allocated - bytes_freed;
+}
+
+extern "C"
+{
+  void* malloc(std::size_t size) noexcept
+  {
+    return Allocated(__libc_malloc(size));
+  }
+
+  void* calloc(std::size_t count, std::size_t size) noexcept
+  {
+    return Allocated(__libc_calloc(count, size));
+  }
+
+  void* realloc(void* ptr, std::size_t size) noexcept
+  {
+    Freeing(ptr);
+    return Allocated(__libc_realloc(ptr, size));
+  }
+
+  void free(void* ptr) noexcept
+  {
+    Freeing(ptr);
+    __libc_free(ptr);
+  }
+
+  void* memalign(std::size_t alignment, std::size_t size) noexcept
+  {
+    return Allocated(__libc_memalign(alignment, size));
+  }
+
+  void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+  {
+    return Allocated(__libc_memalign(alignment, size));
+  }
+
+  int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept
+  {
+    if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+      return EINVAL;
+    void* allocated = Allocated(__libc_memalign(alignment, size));
+    if (!allocated && size != 0)
+      return ENOMEM;
+    *ptr = allocated;
+    return 0;
+  }
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+#include <tuvx/util/perf_counters.h>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+
+namespace
+{
+  /// @brief Hardware events for each counter, in the order of PerfCountersRead()
+  const uint64_t kEvents[kPerfCounterCount] = { PERF_COUNT_HW_CPU_CYCLES,
+                                                PERF_COUNT_HW_INSTRUCTIONS,
+                                                PERF_COUNT_HW_CACHE_REFERENCES,
+                                                PERF_COUNT_HW_CACHE_MISSES };
+
+  /// @brief Counter group of one thread
+  ///
+  /// The first counter that opens leads the group, so that all counters are
+  /// scheduled together and are read with one system call.
+  class CounterGroup
+  {
+   public:
+    CounterGroup()
+    {
+      for (int i = 0; i < kPerfCounterCount; ++i)
+      {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = kEvents[i];
+        attr.disabled = leader_ < 0 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0));
+        if (fds_[i] < 0)
+          continue;
+        if (leader_ < 0)
+          leader_ = fds_[i];
+        slots_[i] = open_++;
+      }
+      if (leader_ >= 0)
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    ~CounterGroup()
+    {
+      for (int i = 0; i < kPerfCounterCount; ++i)
+        if (fds_[i] >= 0)
+          close(fds_[i]);
+    }
+
+    void Read(int64_t* values) const
+    {
+      for (int i = 0; i < kPerfCounterCount; ++i)
+        values[i] = -1;
+      // number of counters, time enabled, time running, counter values
+      uint64_t buffer[3 + kPerfCounterCount];
+      if (leader_ < 0 || read(leader_, buffer, sizeof(buffer)) <= 0 || buffer[2] == 0)
+        return;
+      const double scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+      for (int i = 0; i < kPerfCounterCount; ++i)
+        if (fds_[i] >= 0)
+          values[i] = static_cast<int64_t>(static_cast<double>(buffer[3 + slots_[i]]) * scale);
+    }
+
+   private:
+    int fds_[kPerfCounterCount] = { -1, -1, -1, -1 };
+    int slots_[kPerfCounterCount] = { 0, 0, 0, 0 };
+    int leader_ = -1;
+    int open_ = 0;
+  };
+}  // namespace
+
+void PerfCountersRead(int64_t* values)
+{
+  static thread_local const CounterGroup group;
+  group.Read(values);
+}
@@ -7,6 +7,8 @@ set -v
 
 tmpdir=$(mktemp -d)
 basedir=$(pwd)
+# comparison tolerances (path relative to the build directory)
+compare_config=${1:-test/regression/radiators/radiation.aerosols.compare.json}
 ln -s $tmpdir `basename $tmpdir`
 
 cp -r odat $tmpdir/odat
@@ -23,7 +25,7 @@ exec_newtuv() {
   valgrind --error-exitcode=1 --trace-children=yes --leak-check=full --gen-suppressions=all --suppressions=test/valgrind.supp $basedir/tuv-x $basedir/test/data/radiators.aerosols.config.json
 }
 exec_analysis() {
-  python3 $basedir/tool/diagnostics/var.compare.py $basedir/test/regression/radiators/radiation.aerosols.compare.json
+  python3 $basedir/tool/diagnostics/var.compare.py $basedir/$compare_config
 }
 
 if ! exec_oldtuv; then
@@ -6,55 +6,6 @@
 
 #include <iostream>
 
-double* CopyVector(const std::vector<double>& vec)
-{
-  double* arr = new double[vec.size()];
-  for (int i = 0; i < vec.size(); i++)
-  {
-    arr[i] = vec[i];
-  }
-  return arr;
-}
-
-template<typename GridPolicy>
-GridPolicy CreateGrid(
-    std::string units,
-    const std::size_t n_columns,
-    const std::size_t n_sections,
-    const double* mid_points,
-    const double* edges)
-{
-  GridPolicy grid(units, n_columns, n_sections);
-  std::size_t index = 0;
-  for (auto& elem : grid.mid_points_)
-  {
-    elem = mid_points[index++];
-  }
-  index = 0;
-  for (auto& elem : grid.edges_)
-  {
-    elem = edges[index++];
-  }
-  return grid;
-}
-
-template<typename GridPolicy>
-GridPolicy CreateFixedGrid(std::string units, const std::size_t sections, const double* mid_points, const double* edges)
-{
-  GridPolicy grid(units, sections);
-  std::size_t index = 0;
-  for (auto& elem : grid.mid_points_)
-  {
-    elem = mid_points[index++];
-  }
-  index = 0;
-  for (auto& elem : grid.edges_)
-  {
-    elem = edges[index++];
-  }
-  return grid;
-}
-
 // Checks certian input values to ensure the data is properly transferred
 // from the Fortran side to the C++ side.
 // If the testing conditions change in the future, this function will need to be updated.
@@ -140,56 +91,12 @@ void CheckInputs(
 
 SolverOutput RunDeltaEddingtonSolver(const SolverInput input)
 {
-  using GridPolicy = tuvx::Grid<tuvx::Array2D<double>>;
-  std::vector<double> solar_zenith_angles(input.solar_zenith_angles_, input.solar_zenith_angles_ + input.n_columns_);
-  std::vector<double> earth_sun_distances(input.earth_sun_distances_, input.earth_sun_distances_ + input.n_columns_);
-  std::map<std::string, GridPolicy> grids;
-  grids["altitude [m]"] =
-      CreateGrid<GridPolicy>("m", input.n_columns_, input.n_levels_, input.altitude_mid_points_, input.altitude_edges_);
-  grids["wavelength [m]"] =
-      CreateFixedGrid<GridPolicy>("m", input.n_wavelengths_, input.wavelength_mid_points_, input.wavelength_edges_);
-  std::map<std::string, tuvx::Profile<tuvx::Array2D<double>>> profiles;
-  tuvx::RadiatorState<tuvx::Array3D<double>> accumulated_radiator_states(
-      input.n_columns_, grids["altitude [m]"], grids["wavelength [m]"]);
-  for (int i = 0; i < input.n_wavelengths_; i++)
-  {
-    for (int j = 0; j < input.n_levels_; j++)
-    {
-      for (int k = 0; k < input.n_columns_; k++)
-      {
-        accumulated_radiator_states.optical_depth_(i, j, k) =
-            input.optical_depths_[i * input.n_levels_ * input.n_columns_ + j * input.n_columns_ + k];
-        accumulated_radiator_states.single_scattering_albedo_(i, j, k) =
-            input.single_scattering_albedos_[i * input.n_levels_ * input.n_columns_ + j * input.n_columns_ + k];
-        accumulated_radiator_states.asymmetry_parameter_(i, j, k) =
-            input.asymmetry_parameters_[i * input.n_levels_ * input.n_columns_ + j * input.n_columns_ + k];
-      }
-    }
-  }
-  tuvx::RadiationField<tuvx::RadiationFieldComponents<tuvx::Array3D<double>>> radiation_field(
-      input.n_columns_, grids["altitude [m]"], grids["wavelength [m]"]);
-  tuvx::DeltaEddington solver;
-  CheckInputs(solar_zenith_angles, earth_sun_distances, grids, profiles, accumulated_radiator_states);
-  solver.Solve(solar_zenith_angles, grids, profiles, accumulated_radiator_states, radiation_field);
-  SolverOutput output;
-  output.n_wavelengths_ = input.n_wavelengths_;
-  output.n_levels_ = input.n_levels_;
-  output.n_columns_ = input.n_columns_;
-  output.flux_direct_ = CopyVector(radiation_field.actinic_flux_.direct_.AsVector());
-  output.flux_up_ = CopyVector(radiation_field.actinic_flux_.upwelling_.AsVector());
-  output.flux_down_ = CopyVector(radiation_field.actinic_flux_.downwelling_.AsVector());
-  output.irrad_direct_ = CopyVector(radiation_field.spectral_irradiance_.direct_.AsVector());
-  output.irrad_up_ = CopyVector(radiation_field.spectral_irradiance_.upwelling_.AsVector());
-  output.irrad_down_ = CopyVector(radiation_field.spectral_irradiance_.downwelling_.AsVector());
-  return output;
-}
-
-void FreeOutput(SolverOutput output)
-{
-  delete[] output.flux_direct_;
-  delete[] output.flux_up_;
-  delete[] output.flux_down_;
-  delete[] output.irrad_direct_;
-  delete[] output.irrad_up_;
-  delete[] output.irrad_down_;
+  DeltaEddingtonProblem problem(input);
+  CheckInputs(
+      problem.solar_zenith_angles_,
+      problem.earth_sun_distances_,
+      problem.grids_,
+      problem.profiles_,
+      problem.accumulated_radiator_states_);
+  return problem.Solve();
 }
@@ -38,10 +38,35 @@ extern "C"
     double* irrad_down_;    // [wavelengths][levels+1][columns]
   };
 
+  // Runs the C++ solver after checking the inputs against the regression
+  // test conditions (defined by the regression test)
   SolverOutput RunDeltaEddingtonSolver(const SolverInput input);
 
+  // Runs the C++ solver without checking the inputs
+  SolverOutput SolveDeltaEddington(const SolverInput input);
+
   void FreeOutput(SolverOutput output);
 
 #ifdef __cplusplus
 }  // extern "C"
+
+/// @brief C++ Delta-Eddington solver inputs converted from a SolverInput
+struct DeltaEddingtonProblem
+{
+  using GridPolicy = tuvx::Grid<tuvx::Array2D<double>>;
+  using ProfilePolicy = tuvx::Profile<tuvx::Array2D<double>>;
+
+  std::vector<double> solar_zenith_angles_;
+  std::vector<double> earth_sun_distances_;
+  std::map<std::string, GridPolicy> grids_;
+  std::map<std::string, ProfilePolicy> profiles_;
+  tuvx::RadiatorState<tuvx::Array3D<double>> accumulated_radiator_states_;
+
+  /// @brief Converts the inputs to the C++ solver
+  DeltaEddingtonProblem(const SolverInput& input);
+
+  /// @brief Runs the C++ solver
+  /// @return Radiation fields, to be freed with FreeOutput()
+  SolverOutput Solve();
+};
 #endif
\ No newline at end of file
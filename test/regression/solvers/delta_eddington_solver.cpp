@@ -0,0 +1,122 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+#include "delta_eddington.hpp"
+
+double* CopyVector(const std::vector<double>& vec)
+{
+  double* arr = new double[vec.size()];
+  for (int i = 0; i < vec.size(); i++)
+  {
+    arr[i] = vec[i];
+  }
+  return arr;
+}
+
+template<typename GridPolicy>
+GridPolicy CreateGrid(
+    std::string units,
+    const std::size_t n_columns,
+    const std::size_t n_sections,
+    const double* mid_points,
+    const double* edges)
+{
+  GridPolicy grid(units, n_columns, n_sections);
+  std::size_t index = 0;
+  for (auto& elem : grid.mid_points_)
+  {
+    elem = mid_points[index++];
+  }
+  index = 0;
+  for (auto& elem : grid.edges_)
+  {
+    elem = edges[index++];
+  }
+  return grid;
+}
+
+template<typename GridPolicy>
+GridPolicy CreateFixedGrid(std::string units, const std::size_t sections, const double* mid_points, const double* edges)
+{
+  GridPolicy grid(units, sections);
+  std::size_t index = 0;
+  for (auto& elem : grid.mid_points_)
+  {
+    elem = mid_points[index++];
+  }
+  index = 0;
+  for (auto& elem : grid.edges_)
+  {
+    elem = edges[index++];
+  }
+  return grid;
+}
+
+std::map<std::string, DeltaEddingtonProblem::GridPolicy> CreateGrids(const SolverInput& input)
+{
+  using GridPolicy = DeltaEddingtonProblem::GridPolicy;
+  std::map<std::string, GridPolicy> grids;
+  grids["altitude [m]"] =
+      CreateGrid<GridPolicy>("m", input.n_columns_, input.n_levels_, input.altitude_mid_points_, input.altitude_edges_);
+  grids["wavelength [m]"] =
+      CreateFixedGrid<GridPolicy>("m", input.n_wavelengths_, input.wavelength_mid_points_, input.wavelength_edges_);
+  return grids;
+}
+
+DeltaEddingtonProblem::DeltaEddingtonProblem(const SolverInput& input)
+    : solar_zenith_angles_(input.solar_zenith_angles_, input.solar_zenith_angles_ + input.n_columns_),
+      earth_sun_distances_(input.earth_sun_distances_, input.earth_sun_distances_ + input.n_columns_),
+      grids_(CreateGrids(input)),
+      accumulated_radiator_states_(input.n_columns_, grids_["altitude [m]"], grids_["wavelength [m]"])
+{
+  for (int i = 0; i < input.n_wavelengths_; i++)
+  {
+    for (int j = 0; j < input.n_levels_; j++)
+    {
+      for (int k = 0; k < input.n_columns_; k++)
+      {
+        accumulated_radiator_states_.optical_depth_(i, j, k) =
+            input.optical_depths_[i * input.n_levels_ * input.n_columns_ + j * input.n_columns_ + k];
+        accumulated_radiator_states_.single_scattering_albedo_(i, j, k) =
+            input.single_scattering_albedos_[i * input.n_levels_ * input.n_columns_ + j * input.n_columns_ + k];
+        accumulated_radiator_states_.asymmetry_parameter_(i, j, k) =
+            input.asymmetry_parameters_[i * input.n_levels_ * input.n_columns_ + j * input.n_columns_ + k];
+      }
+    }
+  }
+}
+
+SolverOutput DeltaEddingtonProblem::Solve()
+{
+  const std::size_t n_columns = solar_zenith_angles_.size();
+  tuvx::RadiationField<tuvx::RadiationFieldComponents<tuvx::Array3D<double>>> radiation_field(
+      n_columns, grids_["altitude [m]"], grids_["wavelength [m]"]);
+  tuvx::DeltaEddington solver;
+  solver.Solve(solar_zenith_angles_, grids_, profiles_, accumulated_radiator_states_, radiation_field);
+  SolverOutput output;
+  output.n_wavelengths_ = grids_["wavelength [m]"].NumberOfSections();
+  output.n_levels_ = grids_["altitude [m]"].NumberOfSections();
+  output.n_columns_ = n_columns;
+  output.flux_direct_ = CopyVector(radiation_field.actinic_flux_.direct_.AsVector());
+  output.flux_up_ = CopyVector(radiation_field.actinic_flux_.upwelling_.AsVector());
+  output.flux_down_ = CopyVector(radiation_field.actinic_flux_.downwelling_.AsVector());
+  output.irrad_direct_ = CopyVector(radiation_field.spectral_irradiance_.direct_.AsVector());
+  output.irrad_up_ = CopyVector(radiation_field.spectral_irradiance_.upwelling_.AsVector());
+  output.irrad_down_ = CopyVector(radiation_field.spectral_irradiance_.downwelling_.AsVector());
+  return output;
+}
+
+SolverOutput SolveDeltaEddington(const SolverInput input)
+{
+  DeltaEddingtonProblem problem(input);
+  return problem.Solve();
+}
+
+void FreeOutput(SolverOutput output)
+{
+  delete[] output.flux_direct_;
+  delete[] output.flux_up_;
+  delete[] output.flux_down_;
+  delete[] output.irrad_direct_;
+  delete[] output.irrad_up_;
+  delete[] output.irrad_down_;
+}
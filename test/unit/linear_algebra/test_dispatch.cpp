@@ -0,0 +1,124 @@
+#include <tuvx/linear_algebra/dispatch.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+const double TOL_DP = std::numeric_limits<double>::epsilon();
+const float TOL_SP = std::numeric_limits<float>::epsilon();
+
+const std::size_t NUMBER_OF_RUNS = 20;
+const std::size_t SYSTEM_SIZE = 240;
+const bool MAKE_DIAGONALLY_DOMINANT = true;
+
+const tuvx::InstructionSet ALL_INSTRUCTION_SETS[] = { tuvx::InstructionSet::Baseline,
+                                                      tuvx::InstructionSet::AVX2,
+                                                      tuvx::InstructionSet::AVX512 };
+
+TEST(InstructionSetTest, Names)
+{
+  for (const auto isa : ALL_INSTRUCTION_SETS)
+  {
+    tuvx::InstructionSet parsed;
+    EXPECT_TRUE(tuvx::ParseInstructionSet(tuvx::InstructionSetName(isa), parsed));
+    EXPECT_EQ(parsed, isa);
+  }
+  tuvx::InstructionSet parsed = tuvx::InstructionSet::Baseline;
+  EXPECT_TRUE(tuvx::ParseInstructionSet("AVX2", parsed));
+  EXPECT_EQ(parsed, tuvx::InstructionSet::AVX2);
+  EXPECT_FALSE(tuvx::ParseInstructionSet("sse9", parsed));
+  EXPECT_EQ(parsed, tuvx::InstructionSet::AVX2);
+}
+
+TEST(InstructionSetTest, Selection)
+{
+  EXPECT_TRUE(tuvx::IsSupported(tuvx::InstructionSet::Baseline));
+  EXPECT_TRUE(tuvx::IsSupported(tuvx::SelectedInstructionSet()));
+
+  // the most capable supported instruction set is chosen by default
+  const tuvx::InstructionSet best = tuvx::SelectInstructionSet(nullptr);
+  for (const auto isa : ALL_INSTRUCTION_SETS)
+  {
+    if (tuvx::IsSupported(isa))
+    {
+      EXPECT_GE(static_cast<int>(best), static_cast<int>(isa));
+    }
+  }
+  EXPECT_EQ(tuvx::SelectInstructionSet(""), best);
+
+  // requests for supported instruction sets are honored, others are ignored
+  EXPECT_EQ(tuvx::SelectInstructionSet("baseline"), tuvx::InstructionSet::Baseline);
+  EXPECT_EQ(tuvx::SelectInstructionSet("sse9"), best);
+  for (const auto isa : ALL_INSTRUCTION_SETS)
+  {
+    const tuvx::InstructionSet selected = tuvx::SelectInstructionSet(tuvx::InstructionSetName(isa));
+    EXPECT_EQ(selected, tuvx::IsSupported(isa) ? isa : best);
+  }
+}
+
+/// @brief Checks that the kernels for every instruction set supported by the
+/// CPU reconstruct the solution of random systems.
+TEST(DispatchTest, DoublePrecision)
+{
+  for (const auto isa : ALL_INSTRUCTION_SETS)
+  {
+    if (!tuvx::IsSupported(isa))
+      continue;
+    double error = 0;
+    double mixed_error = 0;
+    for (std::size_t j = 0; j < NUMBER_OF_RUNS; j++)
+    {
+      std::vector<double> x(SYSTEM_SIZE);
+      tuvx::TridiagonalMatrix<double> A(SYSTEM_SIZE);
+      tuvx::FillRandom<double>(A, j + 1, MAKE_DIAGONALLY_DOMINANT);
+      tuvx::FillRandom<double>(x, j + 1);
+      std::vector<double> b = tuvx::dispatch::Dot(isa, A, x);
+      std::vector<double> b_mixed = b;
+      EXPECT_LE(tuvx::ComputeError<double>(tuvx::Dot<double>(A, x), b), TOL_DP);
+      tuvx::dispatch::SolveMixedPrecision(isa, A, b_mixed);
+      tuvx::dispatch::Solve(isa, A, b);
+      error += tuvx::ComputeError<double>(x, b);
+      mixed_error += tuvx::ComputeError<double>(x, b_mixed);
+    }
+    EXPECT_LE(error / NUMBER_OF_RUNS, TOL_DP) << tuvx::InstructionSetName(isa);
+    EXPECT_LE(mixed_error / NUMBER_OF_RUNS, 2 * TOL_DP) << tuvx::InstructionSetName(isa);
+  }
+}
+
+TEST(DispatchTest, SinglePrecision)
+{
+  for (const auto isa : ALL_INSTRUCTION_SETS)
+  {
+    if (!tuvx::IsSupported(isa))
+      continue;
+    float error = 0;
+    for (std::size_t j = 0; j < NUMBER_OF_RUNS; j++)
+    {
+      std::vector<float> x(SYSTEM_SIZE);
+      tuvx::TridiagonalMatrix<float> A(SYSTEM_SIZE);
+      tuvx::FillRandom<float>(A, j + 1, MAKE_DIAGONALLY_DOMINANT);
+      tuvx::FillRandom<float>(x, j + 1);
+      std::vector<float> b = tuvx::dispatch::Dot(isa, A, x);
+      tuvx::dispatch::Solve(isa, A, b);
+      error += tuvx::ComputeError<float>(x, b);
+    }
+    EXPECT_LE(error / NUMBER_OF_RUNS, TOL_SP) << tuvx::InstructionSetName(isa);
+  }
+}
+
+/// @brief Checks that the dispatched kernels use the selected instruction set
+TEST(DispatchTest, Selected)
+{
+  std::vector<double> x(SYSTEM_SIZE);
+  tuvx::TridiagonalMatrix<double> A(SYSTEM_SIZE);
+  tuvx::FillRandom<double>(A, 1, MAKE_DIAGONALLY_DOMINANT);
+  tuvx::FillRandom<double>(x, 1);
+  std::vector<double> b = tuvx::dispatch::Dot(A, x);
+  std::vector<double> b_selected = b;
+  tuvx::TridiagonalMatrix<double> A_selected = A;
+  tuvx::dispatch::Solve(A, b);
+  tuvx::dispatch::Solve(tuvx::SelectedInstructionSet(), A_selected, b_selected);
+  EXPECT_EQ(b, b_selected);
+}
@@ -0,0 +1,95 @@
+#include <tuvx/linear_algebra/linear_algebra.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+const double TOL_DP = std::numeric_limits<double>::epsilon();
+const float TOL_SP = std::numeric_limits<float>::epsilon();
+
+const std::size_t NUMBER_OF_RUNS = 20;
+const std::size_t SYSTEM_SIZE = 10;
+const std::size_t NUMBER_OF_LAYERS = 120;
+const bool MAKE_DIAGONALLY_DOMINANT = true;
+
+/// @brief Mixed-precision Tridiagonal Solver Test for random systems.
+/// Generate random diagonally dominant tridiagonal matrix $A$ and vector $x$,
+/// compute $b=A \cdot x$, and check that the solution is reconstructed to
+/// double precision after iterative refinement.
+TEST(MixedPrecisionSolveTest, RandomSystems)
+{
+  double error = 0;
+  for (std::size_t j = 0; j < NUMBER_OF_RUNS; j++)
+  {
+    std::vector<double> x(SYSTEM_SIZE);
+    std::vector<double> b(SYSTEM_SIZE);
+    tuvx::TridiagonalMatrix<double> A(SYSTEM_SIZE);
+
+    tuvx::FillRandom<double>(A, j + 1, MAKE_DIAGONALLY_DOMINANT);
+    tuvx::FillRandom<double>(x, j + 1);
+    b = tuvx::Dot<double>(A, x);
+    tuvx::SolveMixedPrecision<double>(A, b);
+
+    error += tuvx::ComputeError<double>(x, b);
+  }
+  error /= NUMBER_OF_RUNS;
+  EXPECT_LE(error, 2 * TOL_DP);
+}
+
+/// @brief Mixed-precision Tridiagonal Solver Test for two-stream systems.
+/// Generate matrices with the structure of the delta-Eddington radiative
+/// transfer system and check that the single precision solution is
+/// refined to double precision.
+TEST(MixedPrecisionSolveTest, TwoStreamSystems)
+{
+  double error = 0;
+  double unrefined_error = 0;
+  for (std::size_t j = 0; j < NUMBER_OF_RUNS; j++)
+  {
+    std::vector<double> x(2 * NUMBER_OF_LAYERS);
+    std::vector<double> b(2 * NUMBER_OF_LAYERS);
+    tuvx::TridiagonalMatrix<double> A(2 * NUMBER_OF_LAYERS);
+
+    tuvx::FillTwoStream<double>(A, j + 1);
+    tuvx::FillRandom<double>(x, j + 1);
+    b = tuvx::Dot<double>(A, x);
+    std::vector<double> b_unrefined = b;
+    tuvx::SolveMixedPrecision<double>(A, b);
+    tuvx::SolveMixedPrecision<double>(A, b_unrefined, 0);
+
+    error += tuvx::ComputeError<double>(x, b);
+    unrefined_error += tuvx::ComputeError<double>(x, b_unrefined);
+  }
+  error /= NUMBER_OF_RUNS;
+  unrefined_error /= NUMBER_OF_RUNS;
+  EXPECT_LE(error, 2 * TOL_DP);
+  EXPECT_LE(unrefined_error, 10 * TOL_SP);
+  EXPECT_GT(unrefined_error, error);
+}
+
+/// @brief Mixed-precision Tridiagonal Solver Test for the smallest systems.
+/// A single equation is solved exactly, and an empty system is left
+/// unchanged.
+TEST(MixedPrecisionSolveTest, SmallSystems)
+{
+  tuvx::TridiagonalMatrix<double> A(1);
+  A.main_diagonal_[0] = 3.0;
+  std::vector<double> b{ 1.5 };
+  tuvx::SolveMixedPrecision<double>(A, b);
+  ASSERT_EQ(b.size(), 1u);
+  EXPECT_EQ(b[0], 0.5);
+
+  // a value that is not representable in single precision
+  b[0] = 3.0 * (1.0 + 1.0e-12);
+  tuvx::SolveMixedPrecision<double>(A, b, 0);
+  EXPECT_DOUBLE_EQ(b[0], 1.0 + 1.0e-12);
+
+  tuvx::TridiagonalMatrix<double> empty(0);
+  EXPECT_TRUE(empty.upper_diagonal_.empty());
+  EXPECT_TRUE(empty.lower_diagonal_.empty());
+  std::vector<double> no_b;
+  tuvx::SolveMixedPrecision<double>(empty, no_b);
+  EXPECT_TRUE(no_b.empty());
+}
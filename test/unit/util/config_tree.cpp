@@ -0,0 +1,78 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+#include <tuvx/util/config_tree.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(ConfigTree, FindsKeys)
+{
+  YAML::Node root = YAML::Load(
+      "foo: 1\n"
+      "bar:\n"
+      "  foo: 2.5\n"
+      "  baz: qux\n"
+      "list: [ a, b, c ]\n");
+  tuvx::ConfigTree tree(root);
+  EXPECT_EQ(tree.Type(tree.Root()), tuvx::ConfigTree::NodeType::Map);
+  EXPECT_EQ(tree.NumberOfChildren(tree.Root()), 3);
+
+  std::size_t foo = tree.Find(tree.Root(), "foo");
+  ASSERT_NE(foo, tuvx::ConfigTree::npos);
+  EXPECT_EQ(tree.Type(foo), tuvx::ConfigTree::NodeType::Scalar);
+  EXPECT_EQ(tree.Key(foo), "foo");
+  EXPECT_EQ(tree.Source(foo).as<int>(), 1);
+
+  std::size_t bar = tree.Find(tree.Root(), "bar");
+  ASSERT_NE(bar, tuvx::ConfigTree::npos);
+  EXPECT_EQ(tree.Type(bar), tuvx::ConfigTree::NodeType::Map);
+  std::size_t bar_foo = tree.Find(bar, "foo");
+  ASSERT_NE(bar_foo, tuvx::ConfigTree::npos);
+  EXPECT_NE(bar_foo, foo);
+  EXPECT_EQ(tree.Source(bar_foo).as<double>(), 2.5);
+  EXPECT_EQ(tree.Source(tree.Find(bar, "baz")).as<std::string>(), "qux");
+
+  EXPECT_EQ(tree.Find(tree.Root(), "baz"), tuvx::ConfigTree::npos);
+  EXPECT_EQ(tree.Find(bar, "bar"), tuvx::ConfigTree::npos);
+  EXPECT_EQ(tree.Find(foo, "foo"), tuvx::ConfigTree::npos);
+}
+
+TEST(ConfigTree, StoresChildrenContiguously)
+{
+  YAML::Node root = YAML::Load("list: [ a, { b: 1 }, c ]\n");
+  tuvx::ConfigTree tree(root);
+  std::size_t list = tree.Find(tree.Root(), "list");
+  ASSERT_NE(list, tuvx::ConfigTree::npos);
+  EXPECT_EQ(tree.Type(list), tuvx::ConfigTree::NodeType::Sequence);
+  ASSERT_EQ(tree.NumberOfChildren(list), 3);
+  std::size_t first = tree.FirstChild(list);
+  EXPECT_EQ(tree.Source(first).as<std::string>(), "a");
+  EXPECT_EQ(tree.Type(first + 1), tuvx::ConfigTree::NodeType::Map);
+  EXPECT_EQ(tree.Source(tree.Find(first + 1, "b")).as<int>(), 1);
+  EXPECT_EQ(tree.Source(first + 2).as<std::string>(), "c");
+}
+
+TEST(ConfigTree, HandlesManyKeys)
+{
+  YAML::Node root;
+  for (int i = 0; i < 1000; ++i)
+    root["key " + std::to_string(i)] = i;
+  tuvx::ConfigTree tree(root);
+  EXPECT_EQ(tree.NumberOfChildren(tree.Root()), 1000);
+  for (int i = 0; i < 1000; ++i)
+  {
+    std::size_t node = tree.Find(tree.Root(), ("key " + std::to_string(i)).c_str());
+    ASSERT_NE(node, tuvx::ConfigTree::npos);
+    EXPECT_EQ(tree.Source(node).as<int>(), i);
+  }
+  EXPECT_EQ(tree.Find(tree.Root(), "key 1000"), tuvx::ConfigTree::npos);
+}
+
+TEST(ConfigTree, CountsDuplicateKeys)
+{
+  YAML::Node root = YAML::Load("{ foo: 1, bar: 2, foo: 3 }");
+  tuvx::ConfigTree tree(root);
+  EXPECT_EQ(tree.Count(tree.Root(), "foo"), 2);
+  EXPECT_EQ(tree.Count(tree.Root(), "bar"), 1);
+  EXPECT_EQ(tree.Count(tree.Root(), "baz"), 0);
+  EXPECT_EQ(tree.Source(tree.Find(tree.Root(), "foo")).as<int>(), 1);
+}
@@ -0,0 +1,153 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+#include <tuvx/util/config_yaml.h>
+
+#include <gtest/gtest.h>
+
+#include <clocale>
+
+TEST(ConfigYaml, ParsesNumbersIndependentOfLocale)
+{
+  const char* locales[] = { "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8" };
+  bool found_locale = false;
+  for (const char* locale : locales)
+  {
+    if (std::setlocale(LC_NUMERIC, locale) != nullptr)
+    {
+      found_locale = true;
+      break;
+    }
+  }
+  if (!found_locale)
+    GTEST_SKIP() << "No locale with a ',' decimal mark is available";
+
+  Yaml* node = YamlCreateFromString(
+      "value: 1.5\n"
+      "values: [ 0.25, -2.5e2 ]\n");
+  bool found = false;
+  double value = YamlGetDouble(node, "value", found);
+  double values[2] = { 0.0, 0.0 };
+  YamlFillDoubleArray(node, "values", values, 2);
+  std::setlocale(LC_NUMERIC, "C");
+  EXPECT_TRUE(found);
+  EXPECT_EQ(value, 1.5);
+  EXPECT_EQ(values[0], 0.25);
+  EXPECT_EQ(values[1], -250.0);
+  YamlDeleteNode(node);
+}
+
+TEST(ConfigYaml, RejectsOutOfRangeNumbers)
+{
+  Yaml* node = YamlCreateFromString(
+      "big: 1.0e999\n"
+      "values: [ 1.0, -1.0e999 ]\n");
+  bool found = false;
+  EXPECT_THROW(YamlGetDouble(node, "big", found), YAML::BadConversion);
+  double values[2] = { 0.0, 0.0 };
+  EXPECT_THROW(YamlFillDoubleArray(node, "values", values, 2), YAML::BadConversion);
+  YamlDeleteNode(node);
+}
+
+TEST(ConfigYaml, ConvertsNumbersAsYamlCpp)
+{
+  const char* yaml =
+      "int: -12\n"
+      "octal: 010\n"
+      "float: 2.5e-1\n"
+      "double: +1.25\n"
+      "special: .inf\n"
+      "too big: 3000000000\n";
+  Yaml* node = YamlCreateFromString(yaml);
+  YAML::Node reference = YAML::Load(yaml);
+  bool found = false;
+  EXPECT_EQ(YamlGetInt(node, "int", found), reference["int"].as<int>());
+  EXPECT_EQ(YamlGetInt(node, "octal", found), reference["octal"].as<int>());
+  EXPECT_EQ(YamlGetFloat(node, "float", found), reference["float"].as<float>());
+  EXPECT_EQ(YamlGetDouble(node, "double", found), reference["double"].as<double>());
+  EXPECT_EQ(YamlGetDouble(node, "special", found), reference["special"].as<double>());
+  EXPECT_THROW(YamlGetInt(node, "too big", found), YAML::BadConversion);
+  EXPECT_EQ(YamlGetInt(node, "missing", found), 0);
+  EXPECT_FALSE(found);
+  YamlDeleteNode(node);
+}
+
+TEST(ConfigYaml, FindsKeysInModifiedDocuments)
+{
+  Yaml* node = YamlCreateFromString("{ foo: 1, bar: [ 1.5, 2.5 ] }");
+  YamlAddInt(node, "baz", 3);
+  bool found = false;
+  EXPECT_EQ(YamlGetInt(node, "foo", found), 1);
+  EXPECT_TRUE(found);
+  EXPECT_EQ(YamlGetInt(node, "baz", found), 3);
+  EXPECT_TRUE(found);
+  EXPECT_EQ(YamlGetInt(node, "missing", found), 0);
+  EXPECT_FALSE(found);
+  EXPECT_EQ(YamlGetArraySize(node, "bar", found), 2);
+  EXPECT_EQ(YamlGetArraySize(node, "missing", found), 0);
+  EXPECT_FALSE(found);
+  EXPECT_EQ(YamlCountKey(node, "baz"), 1);
+  EXPECT_EQ(YamlCountKey(node, "missing"), 0);
+  YamlDeleteNode(node);
+}
+
+TEST(ConfigYaml, DetachesOnlyModifiedSubtrees)
+{
+  Yaml* root = YamlCreateFromString("{ a: { b: { c: 1 } }, d: { e: sibling } }");
+  bool found = false;
+  Yaml* a = YamlGetNode(root, "a", found);
+  Yaml* b = YamlGetNode(a, "b", found);
+  Yaml* d = YamlGetNode(root, "d", found);
+  const char* sibling = YamlGetString(d, "e", found).ptr_;
+
+  // modifying a subtree leaves the rest of the document shared
+  YamlAddInt(b, "f", 2);
+  EXPECT_EQ(YamlGetString(d, "e", found).ptr_, sibling);
+  Yaml* b_from_root = YamlGetNode(a, "b", found);
+  EXPECT_EQ(YamlGetInt(b_from_root, "f", found), 2);
+  EXPECT_TRUE(found);
+  YamlDeleteNode(b_from_root);
+
+  // modifying a parent keeps earlier changes below it, and later changes
+  // through handles below it remain visible
+  YamlAddInt(a, "g", 3);
+  YamlAddInt(b, "h", 4);
+  EXPECT_EQ(YamlGetString(d, "e", found).ptr_, sibling);
+  Yaml* copy = YamlCopyNode(root);
+  YamlAddInt(b, "i", 5);
+  Yaml* a_copy = YamlGetNode(copy, "a", found);
+  Yaml* b_copy = YamlGetNode(a_copy, "b", found);
+  EXPECT_EQ(YamlGetInt(a_copy, "g", found), 3);
+  EXPECT_EQ(YamlGetInt(b_copy, "c", found), 1);
+  EXPECT_EQ(YamlGetInt(b_copy, "f", found), 2);
+  EXPECT_EQ(YamlGetInt(b_copy, "h", found), 4);
+  YamlGetInt(b_copy, "i", found);
+  EXPECT_FALSE(found);
+  Yaml* b_from_a = YamlGetNode(a, "b", found);
+  EXPECT_EQ(YamlGetInt(b_from_a, "i", found), 5);
+  EXPECT_TRUE(found);
+  EXPECT_EQ(YamlSize(b_from_a), 4);
+
+  for (Yaml* node : { root, a, b, d, copy, a_copy, b_copy, b_from_a })
+    YamlDeleteNode(node);
+}
+
+TEST(ConfigYaml, ReadsArraysModifiedThroughTheirOwnHandles)
+{
+  Yaml* root = YamlCreateFromString("{ a: { values: [ 1.5, 2.5 ], other: [ 3.5 ] } }");
+  bool found = false;
+  Yaml* a = YamlGetNode(root, "a", found);
+  Yaml* values = YamlGetNode(a, "values", found);
+
+  // the array is modified through a handle to the array itself, so the
+  // handle to its parent remains a view of the compiled document
+  YamlAddDouble(values, "extra", 4.5);
+  EXPECT_EQ(YamlGetArraySize(a, "values", found), 3);
+  EXPECT_TRUE(found);
+  EXPECT_EQ(YamlGetArraySize(a, "other", found), 1);
+  double buffer[1] = { 0.0 };
+  YamlFillDoubleArray(a, "other", buffer, 1);
+  EXPECT_EQ(buffer[0], 3.5);
+
+  for (Yaml* node : { root, a, values })
+    YamlDeleteNode(node);
+}
@@ -28,7 +28,10 @@ def get_variable_from_file(file_path, var_type):
 
 # Compares values of real arrays from Fortran binary files
 # using provided tolerances
-def compare_var(var_name):
+#
+# Elements smaller than the relative threshold times the largest
+# magnitude in either array are not compared
+def compare_var(var_name, relative_threshold):
     global data_path
     global n_vertical_bins
     global n_wavelength_bins
@@ -54,7 +57,7 @@ def compare_var(var_name):
     # get percent difference
     diff = numpy.zeros( var_old.size )
     max_val = max( numpy.max(numpy.abs(var_old)),numpy.max(numpy.abs(var_new)) )
-    threshold = 1.0e-20*max_val
+    threshold = relative_threshold*max_val
     for n in range( var_old.size ):
         if( max( abs(var_old[n]),abs(var_new[n]) ) > threshold ):
             diff[n] = abs(var_old[n] / var_new[n] - 1.0) * 100.0
@@ -81,7 +84,9 @@ def compare_var(var_name):
 # Perform an analysis of TUV output based on given metrics
 def analyze_output(config):
     for var_name, options in config.items() :
-        results = compare_var(var_name)
+        options = dict(options)
+        relative_threshold = options.pop("relative threshold", 1.0e-20)
+        results = compare_var(var_name, relative_threshold)
         for metric, tolerance in options.items() :
             if not metric in results.keys() :
                 print(f"Error: invalid comparison metric for {var_name}: {metric}")
@@ -105,11 +110,14 @@ if len(sys.argv) == 0 :
     print(f"  \"variable name\" : {{")
     print(f"    \"minimum difference\" : 12.3,")
     print(f"    \"maximum difference\" : 32.4,")
-    print(f"    \"RMS difference\" : 13.7")
+    print(f"    \"RMS difference\" : 13.7,")
+    print(f"    \"relative threshold\" : 1.0e-20")
     print(f"  }}")
     print(f"}}")
     print(f"")
     print(f"Muliple variables per file are allowed and each difference tolerance is optional.")
+    print(f"Differences are in percent. Elements smaller than the relative threshold")
+    print(f"(default 1.0e-20) times the largest magnitude of the variable are not compared.")
     sys.exit(0)
 
 # process each specified configuration file